@@ -34,7 +34,16 @@ AliCFManager::AliCFManager() :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fOptimizeCutOrder(kFALSE),
+  fPartPlanCompiled(kFALSE),
+  fPartPlanCuts(),
+  fPartPlanEntries(),
+  fPartPlanStepOffset(),
+  fPartPlanResult(),
+  fPartPlanNEval(),
+  fPartPlanNReject(),
+  fPartPlanNCalls(0)
 { 
   //
   // ctor
@@ -48,7 +57,16 @@ AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fOptimizeCutOrder(kFALSE),
+  fPartPlanCompiled(kFALSE),
+  fPartPlanCuts(),
+  fPartPlanEntries(),
+  fPartPlanStepOffset(),
+  fPartPlanResult(),
+  fPartPlanNEval(),
+  fPartPlanNReject(),
+  fPartPlanNCalls(0)
 { 
    //
    // ctor
@@ -62,7 +80,16 @@ AliCFManager::AliCFManager(const AliCFManager& c) :
   fEvtContainer(c.fEvtContainer),
   fPartContainer(c.fPartContainer),
   fEvtCutList(c.fEvtCutList),
-  fPartCutList(c.fPartCutList)
+  fPartCutList(c.fPartCutList),
+  fOptimizeCutOrder(c.fOptimizeCutOrder),
+  fPartPlanCompiled(kFALSE),
+  fPartPlanCuts(),
+  fPartPlanEntries(),
+  fPartPlanStepOffset(),
+  fPartPlanResult(),
+  fPartPlanNEval(),
+  fPartPlanNReject(),
+  fPartPlanNCalls(0)
 { 
    //
    //copy ctor
@@ -84,6 +111,8 @@ AliCFManager& AliCFManager::operator=(const AliCFManager& c)
   this->fPartContainer=c.fPartContainer;
   this->fEvtCutList=c.fEvtCutList;
   this->fPartCutList=c.fPartCutList;
+  this->fOptimizeCutOrder=c.fOptimizeCutOrder;
+  this->fPartPlanCompiled=kFALSE;
   return *this ;
 }
 
@@ -105,12 +134,12 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
     return kTRUE;
   }
   if(!fPartCutList[isel])return kTRUE;
+  Bool_t checkAll=selcuts.Contains("all");
   TObjArrayIter iter(fPartCutList[isel]);
   AliCFCutBase *cut = 0;
   while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+    if(!checkAll && !CompareStrings(cut->GetName(),selcuts)) continue;
+    if(!cut->IsSelected(obj)) return kFALSE;   
   }
   return kTRUE;
 }
@@ -126,12 +155,12 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
       return kTRUE;
   }
   if(!fEvtCutList[isel])return kTRUE;
+  Bool_t checkAll=selcuts.Contains("all");
   TObjArrayIter iter(fEvtCutList[isel]);
   AliCFCutBase *cut = 0;
   while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+    if(!checkAll && !CompareStrings(cut->GetName(),selcuts)) continue;
+    if(!cut->IsSelected(obj)) return kFALSE;   
   }
   return kTRUE;
 }
@@ -267,4 +296,125 @@ void AliCFManager::SetParticleCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fPartCutList[isel] = array;
+  fPartPlanCompiled = kFALSE;
+}
+
+//_____________________________________________________________________________
+UInt_t AliCFManager::CheckParticleCutsMask(TObject *obj, Int_t firstStep, Int_t lastStep, Bool_t sequential) const {
+  //
+  // check whether object obj passes each of the particle-level selections 
+  // firstStep <= isel < lastStep: bit (isel-firstStep) of the returned mask is
+  // set if all the cuts of step isel are passed. Each distinct cut object is 
+  // evaluated at most once, and the evaluation of a step stops at the first 
+  // rejecting cut. In sequential mode the steps after the first failed one 
+  // are not evaluated
+  //
+
+  if(!fPartPlanCompiled) CompileParticleCutPlan();
+
+  const Int_t nstep = fPartPlanStepOffset.size() - 1;
+  const Int_t nmaxstep = 8*sizeof(UInt_t);
+  if(lastStep < 0 || lastStep > nstep) lastStep = nstep;
+  if(firstStep < 0 || firstStep >= lastStep){
+    AliWarning(Form("Empty selection range [%i,%i), max. number of selections= %i", firstStep, lastStep, nstep));
+    return 0;
+  }
+  if(lastStep - firstStep > nmaxstep){
+    AliWarning(Form("Only %d selection steps can be checked at once, range [%i,%i) truncated", nmaxstep, firstStep, lastStep));
+    lastStep = firstStep + nmaxstep;
+  }
+
+  if(fOptimizeCutOrder && ++fPartPlanNCalls == fgkNCallsCutOrder) OptimizeParticleCutPlan();
+
+  const Int_t ncuts = fPartPlanCuts.size();
+  for(Int_t icut=0; icut<ncuts; icut++) fPartPlanResult[icut] = -1;
+
+  UInt_t mask = 0;
+  for(Int_t isel=firstStep; isel<lastStep; isel++){
+    Bool_t selected = kTRUE;
+    for(Int_t ientry=fPartPlanStepOffset[isel]; ientry<fPartPlanStepOffset[isel+1]; ientry++){
+      Int_t icut = fPartPlanEntries[ientry];
+      if(fPartPlanResult[icut] < 0){
+        fPartPlanResult[icut] = fPartPlanCuts[icut]->IsSelected(obj);
+        if(fOptimizeCutOrder){
+          fPartPlanNEval[icut]++;
+          if(!fPartPlanResult[icut]) fPartPlanNReject[icut]++;
+        }
+      }
+      if(!fPartPlanResult[icut]){
+        selected = kFALSE;
+        break;
+      }
+    }
+    if(selected) mask |= (1u << (isel - firstStep));
+    else if(sequential) break;
+  }
+  return mask;
+}
+
+//_____________________________________________________________________________
+void AliCFManager::CompileParticleCutPlan() const {
+  //
+  // flatten the particle-level cut lists into a single array of distinct cuts
+  // and per-step index ranges
+  //
+
+  const Int_t nstep = fNStepPart;
+
+  fPartPlanCuts.clear();
+  fPartPlanEntries.clear();
+  fPartPlanStepOffset.assign(1, 0);
+  for(Int_t isel=0; isel<nstep; isel++){
+    if(fPartCutList && fPartCutList[isel]){
+      TObjArrayIter iter(fPartCutList[isel]);
+      AliCFCutBase *cut = 0;
+      while ( (cut = (AliCFCutBase*)iter.Next()) ) {
+        Int_t icut = 0;
+        while(icut < (Int_t)fPartPlanCuts.size() && fPartPlanCuts[icut] != cut) icut++;
+        if(icut == (Int_t)fPartPlanCuts.size()) fPartPlanCuts.push_back(cut);
+        fPartPlanEntries.push_back(icut);
+      }
+    }
+    fPartPlanStepOffset.push_back(fPartPlanEntries.size());
+  }
+
+  fPartPlanResult.assign(fPartPlanCuts.size(), -1);
+  fPartPlanNEval.assign(fPartPlanCuts.size(), 0);
+  fPartPlanNReject.assign(fPartPlanCuts.size(), 0);
+  fPartPlanNCalls = 0;
+  fPartPlanCompiled = kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliCFManager::OptimizeParticleCutPlan() const {
+  //
+  // sort the cuts of each step by decreasing measured rejection rate. Steps 
+  // containing QA-enabled cuts keep the user order, since the QA histograms 
+  // depend on which cuts are evaluated
+  //
+
+  const Int_t nstep = fPartPlanStepOffset.size() - 1;
+  for(Int_t isel=0; isel<nstep; isel++){
+    Int_t first = fPartPlanStepOffset[isel], last = fPartPlanStepOffset[isel+1];
+    Bool_t hasQA = kFALSE;
+    for(Int_t ientry=first; ientry<last; ientry++)
+      if(fPartPlanCuts[fPartPlanEntries[ientry]]->IsQAOn()) hasQA = kTRUE;
+    if(hasQA) continue;
+
+    // insertion sort, stable and cheap for the few cuts of a step
+    for(Int_t ientry=first+1; ientry<last; ientry++){
+      Int_t icut = fPartPlanEntries[ientry];
+      Double_t rate = fPartPlanNEval[icut] ? Double_t(fPartPlanNReject[icut])/fPartPlanNEval[icut] : 0.;
+      Int_t jentry = ientry;
+      while(jentry > first){
+        Int_t jcut = fPartPlanEntries[jentry-1];
+        Double_t jrate = fPartPlanNEval[jcut] ? Double_t(fPartPlanNReject[jcut])/fPartPlanNEval[jcut] : 0.;
+        if(jrate >= rate) break;
+        fPartPlanEntries[jentry] = jcut;
+        jentry--;
+      }
+      fPartPlanEntries[jentry] = icut;
+    }
+  }
+  AliDebug(1, "Particle cuts reordered by measured rejection rate");
 }
@@ -24,10 +24,13 @@
 // now the number of steps are fixed by the particle/event containers themselves.
 //
 
+#include <vector>
 #include "TNamed.h"
 #include "AliCFContainer.h"
 #include "AliLog.h"
 
+class AliCFCutBase;
+
 //____________________________________________________________________________
 class AliCFManager : public TNamed 
 {
@@ -79,7 +82,7 @@ class AliCFManager : public TNamed
   
   //Set the number of steps (already done if you have defined your containers)
   virtual void SetNStepEvent   (Int_t nstep) {fNStepEvt  = nstep;}
-  virtual void SetNStepParticle(Int_t nstep) {fNStepPart = nstep;}
+  virtual void SetNStepParticle(Int_t nstep) {fNStepPart = nstep; fPartPlanCompiled = kFALSE;}
 
   //Setter for event-level selection cut list at selection step isel
   virtual void SetEventCutsList(Int_t isel, TObjArray* array) ;
@@ -116,6 +119,18 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Check the particle-level selection steps [firstStep,lastStep) at once: bit 
+  //(isel-firstStep) of the returned mask is set if obj passes *all* the cuts 
+  //of step isel (lastStep<0 means up to the last step). A cut object used in 
+  //several steps is evaluated only once per call. If sequential is set, the 
+  //steps are treated as a cascade and the check stops at the first failed step
+  virtual UInt_t CheckParticleCutsMask(TObject *obj, Int_t firstStep=0, Int_t lastStep=-1, Bool_t sequential=kFALSE) const;
+
+  //Let CheckParticleCutsMask evaluate first the cuts with the largest measured
+  //rejection rate. Only steps without QA-enabled cuts are reordered, so that 
+  //the selection and the QA histograms are unchanged
+  void SetOptimizeCutOrder(Bool_t b=kTRUE) {fOptimizeCutOrder = b; fPartPlanCompiled = kFALSE;}
+
  private:
   
   //number of steps
@@ -130,9 +145,26 @@ class AliCFManager : public TNamed
   //Particle-level selections
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
+  Bool_t fOptimizeCutOrder; // reorder the particle cuts by measured rejection rate
+
+  //compiled particle-level cut plan, built at the first call of CheckParticleCutsMask.
+  //It spans all the steps, a step range only selects a contiguous slice of it
+  mutable Bool_t fPartPlanCompiled;                   //! plan is up to date
+  mutable std::vector<AliCFCutBase*> fPartPlanCuts;   //! distinct cut objects of all steps
+  mutable std::vector<Int_t> fPartPlanEntries;        //! index in fPartPlanCuts of the cuts of each step
+  mutable std::vector<Int_t> fPartPlanStepOffset;     //! [fNStepPart+1] first entry of each step
+  mutable std::vector<Int_t> fPartPlanResult;         //! result of each distinct cut for the current object
+  mutable std::vector<Long64_t> fPartPlanNEval;       //! number of evaluations of each distinct cut
+  mutable std::vector<Long64_t> fPartPlanNReject;     //! number of rejections of each distinct cut
+  mutable Long64_t fPartPlanNCalls;                   //! number of calls since the plan was compiled
+
+  static const Long64_t fgkNCallsCutOrder = 1000;     // number of calls after which the cuts are reordered
+
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  void CompileParticleCutPlan() const;
+  void OptimizeParticleCutPlan() const;
 
-  ClassDef(AliCFManager,2);
+  ClassDef(AliCFManager,3);
 };
 
 
@@ -0,0 +1,267 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+#include <algorithm>
+
+// --- AliRoot system ---
+#include "AliLog.h"
+
+// --- CaloTrackCorrelations ---
+#include "AliCaloTrackEtaPhiGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(AliCaloTrackEtaPhiGrid) ;
+/// \endcond
+
+/// Safety margin added to the query windows, to be insensitive
+/// to rounding differences between the grid and the caller selection.
+static const Float_t kGridQueryMargin = 1.e-3 ;
+
+//____________________________________________________
+/// Default constructor, |eta| < 1 and cells of 0.1.
+//____________________________________________________
+AliCaloTrackEtaPhiGrid::AliCaloTrackEtaPhiGrid() :
+TObject(),
+fEtaMax(0), fCellSize(0),
+fNEta(0), fNPhi(0),
+fEtaCellSize(0), fPhiCellSize(0),
+fNItems(0), fFilled(kFALSE),
+fCellFirst(), fCellItems(), fItemCell(), fCellMark()
+{
+  SetBinning(1.,0.1);
+}
+
+//____________________________________________________________________________
+/// Constructor.
+///
+/// \param etaMax: half width of the grid in eta.
+/// \param cellSize: approximate size of the cells in eta and phi.
+//____________________________________________________________________________
+AliCaloTrackEtaPhiGrid::AliCaloTrackEtaPhiGrid(Float_t etaMax, Float_t cellSize) :
+TObject(),
+fEtaMax(0), fCellSize(0),
+fNEta(0), fNPhi(0),
+fEtaCellSize(0), fPhiCellSize(0),
+fNItems(0), fFilled(kFALSE),
+fCellFirst(), fCellItems(), fItemCell(), fCellMark()
+{
+  SetBinning(etaMax,cellSize);
+}
+
+//____________________________________________________________________________
+/// Define the grid cells. The number of cells is rounded up so that
+/// they cover exactly [-etaMax,etaMax] and [0,2pi).
+//____________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::SetBinning(Float_t etaMax, Float_t cellSize)
+{
+  if ( etaMax <= 0 || cellSize <= 0 )
+  {
+    AliWarning(Form("Wrong binning eta max %2.2f, cell size %2.2f, use 1 and 0.1",etaMax,cellSize));
+    etaMax   = 1. ;
+    cellSize = 0.1;
+  }
+
+  fEtaMax   = etaMax;
+  fCellSize = cellSize;
+
+  fNEta = TMath::Max(1,TMath::CeilNint(2*fEtaMax/fCellSize));
+  fNPhi = TMath::Max(1,TMath::CeilNint(TMath::TwoPi()/fCellSize));
+
+  fEtaCellSize = 2*fEtaMax/fNEta;
+  fPhiCellSize = TMath::TwoPi()/fNPhi;
+
+  fCellFirst.Set(fNEta*fNPhi+1);
+  fCellMark .Set(fNEta*fNPhi);
+
+  Reset();
+}
+
+//____________________________________________________________________________
+/// Declare the content obsolete, to be called at each new event.
+//____________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::Reset()
+{
+  fFilled = kFALSE;
+  fNItems = 0;
+}
+
+//____________________________________________________________________________
+/// \return Eta cell, the first and last cells collect the entries out of the grid.
+//____________________________________________________________________________
+Int_t AliCaloTrackEtaPhiGrid::EtaCell(Float_t eta) const
+{
+  if ( eta <= -fEtaMax ) return 0;
+  if ( eta >=  fEtaMax ) return fNEta-1;
+
+  Int_t ieta = Int_t((eta+fEtaMax)/fEtaCellSize);
+
+  return ieta < fNEta ? ieta : fNEta-1;
+}
+
+//____________________________________________________________________________
+/// \return Phi cell, phi is brought to [0,2pi) first.
+//____________________________________________________________________________
+Int_t AliCaloTrackEtaPhiGrid::PhiCell(Float_t phi) const
+{
+  Double_t phiW = phi - TMath::TwoPi()*TMath::Floor(phi/TMath::TwoPi());
+
+  Int_t iphi = Int_t(phiW/fPhiCellSize);
+
+  return iphi < fNPhi ? iphi : fNPhi-1;
+}
+
+//____________________________________________________________________________
+/// Sort the entries of the list into the cells.
+///
+/// \param nItems: number of entries in the list.
+/// \param eta: eta of each entry.
+/// \param phi: phi of each entry.
+//____________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::Fill(Int_t nItems, const Float_t * eta, const Float_t * phi)
+{
+  Int_t nCells = fNEta*fNPhi;
+
+  fNItems = nItems;
+
+  if ( fCellItems.GetSize() < nItems )
+  {
+    fCellItems.Set(nItems);
+    fItemCell .Set(nItems);
+  }
+
+  Int_t * first = fCellFirst.GetArray();
+  Int_t * cell  = fItemCell .GetArray();
+  Int_t * items = fCellItems.GetArray();
+
+  for(Int_t icell = 0; icell <= nCells; icell++) first[icell] = 0;
+
+  // Count the entries per cell, entries with undefined eta or phi
+  // never pass any selection, they are not indexed
+  for(Int_t item = 0; item < nItems; item++)
+  {
+    if ( eta[item] != eta[item] || phi[item] != phi[item] )
+    {
+      cell[item] = -1;
+      continue;
+    }
+
+    cell[item] = EtaCell(eta[item])*fNPhi+PhiCell(phi[item]);
+
+    first[cell[item]+1]++;
+  }
+
+  for(Int_t icell = 0; icell < nCells; icell++) first[icell+1] += first[icell];
+
+  // Place the entries, keeping the list order inside each cell,
+  // after this loop first[i] points to the start of cell i+1
+  for(Int_t item = 0; item < nItems; item++)
+  {
+    if ( cell[item] < 0 ) continue;
+
+    items[first[cell[item]]++] = item;
+  }
+
+  for(Int_t icell = nCells; icell > 0; icell--) first[icell] = first[icell-1];
+  first[0] = 0;
+
+  fFilled = kTRUE;
+}
+
+//____________________________________________________________________________
+/// Select the cells in [etaMin,etaMax] cells and phi window, phi periodic.
+//____________________________________________________________________________
+void AliCaloTrackEtaPhiGrid::MarkPhiRange(Float_t phiMin, Float_t phiMax, Int_t etaMin, Int_t etaMax)
+{
+  Char_t * mark = fCellMark.GetArray();
+
+  Int_t iphiMin = 0;
+  Int_t iphiMax = fNPhi-1;
+
+  if ( phiMax-phiMin < TMath::TwoPi() )
+  {
+    iphiMin = TMath::FloorNint(phiMin/fPhiCellSize);
+    iphiMax = TMath::FloorNint(phiMax/fPhiCellSize);
+    if ( iphiMax-iphiMin >= fNPhi ) iphiMax = iphiMin+fNPhi-1;
+  }
+
+  for(Int_t ieta = etaMin; ieta <= etaMax; ieta++)
+  {
+    for(Int_t i = iphiMin; i <= iphiMax; i++)
+    {
+      Int_t iphi = ((i % fNPhi) + fNPhi) % fNPhi;
+      mark[ieta*fNPhi+iphi] = 1;
+    }
+  }
+}
+
+//____________________________________________________________________________
+/// Get the entries that can be inside a cone around the candidate.
+///
+/// \param etaC: candidate eta.
+/// \param phiC: candidate phi.
+/// \param coneSize: cone radius.
+/// \param bands: add the eta band (cone phi window, all eta) and the phi band (cone eta window, all phi).
+/// \param items: list indices of the selected entries, increasing order, output.
+/// \return number of selected entries.
+//____________________________________________________________________________
+Int_t AliCaloTrackEtaPhiGrid::GetItemsInCone(Float_t etaC, Float_t phiC, Float_t coneSize,
+                                             Bool_t bands, TArrayI & items)
+{
+  if ( !fFilled || fNItems == 0 ) return 0;
+
+  // Nothing is at a defined distance of an undefined candidate
+  if ( etaC != etaC || phiC != phiC ) return 0;
+
+  Int_t nCells = fNEta*fNPhi;
+
+  fCellMark.Reset();
+
+  Float_t window = coneSize+kGridQueryMargin;
+
+  Int_t ietaMin = EtaCell(etaC-window);
+  Int_t ietaMax = EtaCell(etaC+window);
+
+  if ( bands )
+  {
+    MarkPhiRange(0, TMath::TwoPi(), ietaMin, ietaMax);
+    MarkPhiRange(phiC-window, phiC+window, 0, fNEta-1);
+  }
+  else
+  {
+    MarkPhiRange(phiC-window, phiC+window, ietaMin, ietaMax);
+  }
+
+  if ( items.GetSize() < fNItems ) items.Set(fNItems);
+
+  const Char_t * mark  = fCellMark .GetArray();
+  const Int_t  * first = fCellFirst.GetArray();
+  const Int_t  * sorted= fCellItems.GetArray();
+  Int_t        * out   = items.GetArray();
+
+  Int_t nSelected = 0;
+  for(Int_t icell = 0; icell < nCells; icell++)
+  {
+    if ( !mark[icell] ) continue;
+
+    for(Int_t j = first[icell]; j < first[icell+1]; j++) out[nSelected++] = sorted[j];
+  }
+
+  // Keep the list order, so that sums and references are filled as in the full loop
+  std::sort(out, out+nSelected);
+
+  return nSelected;
+}
@@ -0,0 +1,92 @@
+#ifndef ALICALOTRACKETAPHIGRID_H
+#define ALICALOTRACKETAPHIGRID_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackEtaPhiGrid
+/// \brief Per event eta-phi cell index of a track or cluster list.
+///
+/// The entries of one of the reader lists (CTS tracks, EMCal or PHOS clusters)
+/// are sorted into cells of a regular eta-phi grid, eta in [-etaMax,etaMax]
+/// with the outer cells open, phi in [0,2pi) with periodic cells.
+/// A cone (and optionally the eta and phi UE bands around it) can then be
+/// queried to get the list indices of the entries that can possibly lie inside,
+/// instead of looping over the full list for each isolation candidate.
+/// The query is conservative: the caller still applies its own selection
+/// on each returned entry, so results are identical to the full loop.
+/// Indices are returned in increasing order.
+//_________________________________________________________________________
+
+// --- ROOT system ---
+#include <TObject.h>
+#include <TArrayI.h>
+#include <TArrayC.h>
+
+class AliCaloTrackEtaPhiGrid : public TObject {
+
+ public:
+
+  AliCaloTrackEtaPhiGrid() ;
+  AliCaloTrackEtaPhiGrid(Float_t etaMax, Float_t cellSize) ;
+
+  /// Virtual destructor.
+  virtual ~AliCaloTrackEtaPhiGrid() { ; }
+
+  void       SetBinning(Float_t etaMax, Float_t cellSize) ;
+
+  void       Reset() ;
+
+  void       Fill(Int_t nItems, const Float_t * eta, const Float_t * phi) ;
+
+  Int_t      GetItemsInCone(Float_t etaC, Float_t phiC, Float_t coneSize,
+                            Bool_t bands, TArrayI & items) ;
+
+  Bool_t     IsFilled()                 const { return fFilled   ; }
+  Int_t      GetNItems()                const { return fNItems   ; }
+  Int_t      GetNEtaCells()             const { return fNEta     ; }
+  Int_t      GetNPhiCells()             const { return fNPhi     ; }
+
+ private:
+
+  Int_t      EtaCell(Float_t eta)       const ;
+  Int_t      PhiCell(Float_t phi)       const ;
+  void       MarkPhiRange(Float_t phiMin, Float_t phiMax, Int_t etaMin, Int_t etaMax) ;
+
+  Float_t    fEtaMax ;                  ///< Half width of the grid in eta, outer cells collect larger |eta|.
+
+  Float_t    fCellSize ;                ///< Requested cell size in eta and phi.
+
+  Int_t      fNEta ;                    ///< Number of cells in eta.
+
+  Int_t      fNPhi ;                    ///< Number of cells in phi.
+
+  Float_t    fEtaCellSize ;             ///< Actual cell size in eta.
+
+  Float_t    fPhiCellSize ;             ///< Actual cell size in phi, 2pi/fNPhi.
+
+  Int_t      fNItems ;                  //!<! Number of entries of the indexed list.
+
+  Bool_t     fFilled ;                  //!<! The grid was filled for the current event.
+
+  TArrayI    fCellFirst ;               //!<! Position in fCellItems of the first entry of each cell, fNEta*fNPhi+1 values.
+
+  TArrayI    fCellItems ;               //!<! List indices sorted by cell.
+
+  TArrayI    fItemCell ;                //!<! Cell of each list entry, -1 if eta or phi is not a number.
+
+  TArrayC    fCellMark ;                //!<! Cells selected by the current query.
+
+  /// Copy constructor not implemented.
+  AliCaloTrackEtaPhiGrid(              const AliCaloTrackEtaPhiGrid & g) ;
+
+  /// Assignment operator not implemented.
+  AliCaloTrackEtaPhiGrid & operator = (const AliCaloTrackEtaPhiGrid & g) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliCaloTrackEtaPhiGrid,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALICALOTRACKETAPHIGRID_H
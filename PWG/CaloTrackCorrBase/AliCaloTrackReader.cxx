@@ -17,6 +17,7 @@
 #include <TFile.h>
 #include <TGeoManager.h>
 #include <TStreamerInfo.h>
+#include <TVector3.h>
 
 // ---- ANALYSIS system ----
 #include "AliMCEvent.h"
@@ -28,6 +29,7 @@
 #include "AliAODEvent.h"
 #include "AliVTrack.h"
 #include "AliVParticle.h"
+#include "AliVCluster.h"
 #include "AliMixedEvent.h"
 //#include "AliTriggerAnalysis.h"
 #include "AliESDVZERO.h"
@@ -47,6 +49,8 @@
 // ---- CaloTrackCorr ---
 #include "AliCalorimeterUtils.h"
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
+#include "AliAODPWG4Particle.h"
 
 // ---- Jets ----
 #include "AliAODJet.h"
@@ -134,12 +138,15 @@ fFillInputBackgroundJetBranch(kFALSE),
 fBackgroundJets(0x0),fInputBackgroundJetBranchName("jets"),
 fAcceptEventsWithBit(0),     fRejectEventsWithBit(0),         fRejectEMCalTriggerEventsWith2Tresholds(0),
 fMomentum(),                 fOutputContainer(0x0),           fEnergyHistogramNbins(0),
-fhNEventsAfterCut(0),        fNMCGenerToAccept(0),            fMCGenerEventHeaderToAccept("")
+fhNEventsAfterCut(0),        fNMCGenerToAccept(0),            fMCGenerEventHeaderToAccept(""),
+fUseEtaPhiGrid(kFALSE),      fEtaPhiGridCellSize(0.1),        fEtaPhiGridEtaMax(1.),
+fEtaPhiGridEta(),            fEtaPhiGridPhi()
 {
   for(Int_t i = 0; i < 8; i++) fhEMCALClusterCutsE [i]= 0x0 ;    
   for(Int_t i = 0; i < 7; i++) fhPHOSClusterCutsE  [i]= 0x0 ;  
   for(Int_t i = 0; i < 6; i++) fhCTSTrackCutsPt    [i]= 0x0 ;    
   for(Int_t j = 0; j < 5; j++) { fMCGenerToAccept  [j] =  ""; fMCGenerIndexToAccept[j] = -1; }
+  for(Int_t i = 0; i < 3; i++) fEtaPhiGrid         [i]= 0x0 ;
   
   InitParameters();
 }
@@ -194,6 +201,12 @@ void AliCaloTrackReader::DeletePointers()
     delete fPHOSClusters ;
   }
   
+  for(Int_t i = 0; i < 3; i++)
+  {
+    delete fEtaPhiGrid[i] ;
+    fEtaPhiGrid[i] = 0x0 ;
+  }
+  
   if(fVertex)
   {
     for (Int_t i = 0; i < fNMixedEvent; i++)
@@ -1281,6 +1294,10 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
 {  
   fEventNumber         = iEntry;
   fTriggerClusterIndex = -1;
+  
+  // Lists are refilled, grids must be rebuilt on demand
+  for(Int_t i = 0; i < 3; i++) { if(fEtaPhiGrid[i]) fEtaPhiGrid[i]->Reset() ; }
+
   fTriggerClusterId    = -1;
   fIsTriggerMatch      = kFALSE;
   fTriggerClusterBC    = -10000;
@@ -3009,6 +3026,7 @@ void AliCaloTrackReader::Print(const Option_t * opt) const
   printf("Use EMCAL Cells =     %d\n",     fFillEMCALCells) ;
   printf("Use PHOS  Cells =     %d\n",     fFillPHOSCells) ;
   printf("Track status    =     %d\n", (Int_t) fTrackStatus) ;
+  printf("Use eta-phi grid =    %d, cell size %2.2f, |eta| < %2.2f\n", fUseEtaPhiGrid, fEtaPhiGridCellSize, fEtaPhiGridEtaMax) ;
 
   printf("Track Mult Eta Cut =  %2.2f\n",  fTrackMultEtaCut) ;
   printf("Write delta AOD =     %d\n",     fWriteOutputDeltaAOD) ;
@@ -3112,6 +3130,8 @@ void AliCaloTrackReader::ResetLists()
   if(fEMCALClusters)   fEMCALClusters -> Clear("C");
   if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
   
+  for(Int_t i = 0; i < 3; i++) { if(fEtaPhiGrid[i]) fEtaPhiGrid[i]->Reset() ; }
+  
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
   
@@ -3119,6 +3139,83 @@ void AliCaloTrackReader::ResetLists()
   fBackgroundJets->Reset();
 }
 
+//___________________________________________________________________________
+/// Get the eta-phi grid index of one of the reader lists, filled the first
+/// time it is requested in the event. The eta and phi of each entry are
+/// calculated as in AliIsolationCut::MakeIsolationCut().
+///
+/// \param list: CTS, EMCal or PHOS list of this reader.
+/// \return the grid, null if the grid is not switched on or the list is not
+/// one of the reader lists (i.e. lists from mixed events are not indexed).
+//___________________________________________________________________________
+AliCaloTrackEtaPhiGrid * AliCaloTrackReader::GetEtaPhiGrid(const TObjArray * list)
+{
+  if ( !fUseEtaPhiGrid || !list ) return 0x0 ;
+  
+  Int_t ilist = -1;
+  if      ( list == fCTSTracks     ) ilist = 0;
+  else if ( list == fEMCALClusters ) ilist = 1;
+  else if ( list == fPHOSClusters  ) ilist = 2;
+  else return 0x0 ;
+  
+  if ( !fEtaPhiGrid[ilist] ) 
+    fEtaPhiGrid[ilist] = new AliCaloTrackEtaPhiGrid(fEtaPhiGridEtaMax, fEtaPhiGridCellSize);
+  
+  AliCaloTrackEtaPhiGrid * grid = fEtaPhiGrid[ilist];
+  
+  if ( grid->IsFilled() ) return grid ;
+  
+  Int_t nItems = list->GetEntriesFast();
+  if ( fEtaPhiGridEta.GetSize() < nItems )
+  {
+    fEtaPhiGridEta.Set(nItems);
+    fEtaPhiGridPhi.Set(nItems);
+  }
+  
+  TVector3 trackVector;
+  for(Int_t item = 0; item < nItems; item++)
+  {
+    Float_t eta = TMath::QuietNaN();
+    Float_t phi = TMath::QuietNaN();
+    
+    TObject * obj = list->At(item);
+    
+    AliVTrack   * track = (ilist == 0) ? dynamic_cast<AliVTrack   *>(obj) : 0x0 ;
+    AliVCluster * calo  = (ilist != 0) ? dynamic_cast<AliVCluster *>(obj) : 0x0 ;
+    
+    if ( track )
+    {
+      trackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+      eta = trackVector.Eta();
+      phi = trackVector.Phi();
+    }
+    else if ( calo )
+    {
+      Int_t evtIndex = 0 ;
+      if (fMixedEvent)
+        evtIndex=fMixedEvent->EventIndexForCaloCluster(calo->GetID()) ;
+      
+      calo->GetMomentum(fMomentum,GetVertex(evtIndex)) ;
+      eta = fMomentum.Eta();
+      phi = fMomentum.Phi();
+    }
+    else if ( AliAODPWG4Particle * part = dynamic_cast<AliAODPWG4Particle*>(obj) )
+    {
+      eta = part->Eta();
+      phi = part->Phi();
+    }
+    
+    if ( phi < 0 ) phi+=TMath::TwoPi();
+    
+    fEtaPhiGridEta[item] = eta;
+    fEtaPhiGridPhi[item] = phi;
+  }
+  
+  grid->Fill(nItems, fEtaPhiGridEta.GetArray(), fEtaPhiGridPhi.GetArray());
+  
+  return grid ;
+}
+
 //___________________________________________
 /// Tag event depending on trigger name.
 /// Set also the L1 bit defining the EGA or EJE triggers.
@@ -29,6 +29,7 @@ class TObjArray ;
 class TTree ;
 class TArrayI ;
 #include <TRandom3.h>
+#include <TArrayF.h>
 
 //--- ANALYSIS system ---
 #include "AliVEvent.h"
@@ -50,6 +51,7 @@ class AliVCluster;
 // --- CaloTrackCorr / EMCAL ---
 #include "AliFiducialCut.h"
 class AliCalorimeterUtils;
+class AliCaloTrackEtaPhiGrid;
 #include "AliAnaWeights.h"
 
 // Jets
@@ -300,6 +302,16 @@ public:
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
   
+  // Eta-phi grid index of the CTS/EMCal/PHOS lists, for isolation cone and UE band queries
+  
+  void             SwitchOnEtaPhiGrid()                    { fUseEtaPhiGrid = kTRUE        ; }
+  void             SwitchOffEtaPhiGrid()                   { fUseEtaPhiGrid = kFALSE       ; }
+  Bool_t           IsEtaPhiGridOn()                  const { return fUseEtaPhiGrid         ; }
+  void             SetEtaPhiGridCellSize(Float_t size)     { fEtaPhiGridCellSize = size    ; }
+  void             SetEtaPhiGridEtaMax(Float_t eta)        { fEtaPhiGridEtaMax   = eta     ; }
+  
+  AliCaloTrackEtaPhiGrid * GetEtaPhiGrid(const TObjArray * list) ;
+  
   //-------------------------------------
   // Event/track selection methods
   //-------------------------------------
@@ -953,6 +965,13 @@ public:
 
   TString          fMCGenerEventHeaderToAccept;    ///<  Accept events that contain at least this event header name
   
+  Bool_t           fUseEtaPhiGrid;                 ///<  Index the CTS/EMCal/PHOS lists in an eta-phi grid, used by the isolation cut.
+  Float_t          fEtaPhiGridCellSize;            ///<  Size in eta and phi of the grid cells.
+  Float_t          fEtaPhiGridEtaMax;              ///<  Half width in eta of the grid, outer cells collect larger |eta|.
+  AliCaloTrackEtaPhiGrid * fEtaPhiGrid[3];         //!<! Grids of the CTS, EMCal and PHOS lists, filled on demand once per event.
+  TArrayF          fEtaPhiGridEta;                 //!<! Temporal array of the eta of the list entries to index.
+  TArrayF          fEtaPhiGridPhi;                 //!<! Temporal array of the phi of the list entries to index.
+  
   /// Copy constructor not implemented.
   AliCaloTrackReader(              const AliCaloTrackReader & r) ; 
   
@@ -960,7 +979,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,76) ;
+  ClassDef(AliCaloTrackReader,77) ;
   /// \endcond
 
 } ;
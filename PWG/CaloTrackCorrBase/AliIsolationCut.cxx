@@ -27,6 +27,7 @@
 
 // --- CaloTrackCorrelations --- 
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiGrid.h"
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
@@ -54,7 +55,8 @@ fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fGridItems()
 {
   InitParameters();
 }
@@ -453,6 +455,13 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   Int_t       ntrackrefs   = 0;
   Int_t       nclusterrefs = 0;
   
+  // If the reader indexes its lists in an eta-phi grid, only loop on the
+  // tracks/clusters in the cells around the cone, and the UE bands if needed.
+  // Selected indices are in list order, results are the same as the full loop.
+  Bool_t      bands        = (fICMethod == kSumBkgSubIC);
+  AliCaloTrackEtaPhiGrid * grid = 0x0;
+  Int_t       nItems       = 0;
+  
   // --------------------------------
   // Check charged tracks in cone.
   // --------------------------------
@@ -460,8 +469,13 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
-    for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+    grid   = reader->GetEtaPhiGrid(plCTS);
+    nItems = grid ? grid->GetItemsInCone(etaC, phiC, fConeSize, bands, fGridItems) : plCTS->GetEntries();
+    
+    for(Int_t item = 0; item < nItems ; item ++ )
     {
+      Int_t ipr = grid ? fGridItems[item] : item;
+      
       AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
       
       if(track)
@@ -606,8 +620,13 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
     
-    for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+    grid   = reader->GetEtaPhiGrid(plNe);
+    nItems = grid ? grid->GetItemsInCone(etaC, phiC, fConeSize, bands, fGridItems) : plNe->GetEntries();
+    
+    for(Int_t item = 0; item < nItems ; item ++ )
     {
+      Int_t ipr = grid ? fGridItems[item] : item;
+      
       AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
       
       if(calo)
@@ -14,6 +14,7 @@
 #pragma link C++ class AliCaloTrackESDReader+;
 #pragma link C++ class AliCaloTrackAODReader+;
 #pragma link C++ class AliCaloTrackMCReader+;
+#pragma link C++ class AliCaloTrackEtaPhiGrid+;
 #pragma link C++ class AliCalorimeterUtils+;
 #pragma link C++ class AliAnalysisTaskCounter+;
 #pragma link C++ class AliAnaCaloTrackCorrMaker+;
@@ -69,7 +69,8 @@ AliGenEMCocktailV2::AliGenEMCocktailV2():AliGenCocktail(),
   fCentrality(AliGenEMlibV2::kpp),
   fV2Systematic(AliGenEMlibV2::kNoV2Sys),
   fForceConv(kFALSE),
-  fSelectedParticles(kGenHadrons)
+  fSelectedParticles(kGenHadrons),
+  fUseLookupTables(kFALSE)
 {
   // Constructor
 }
@@ -141,6 +142,7 @@ void AliGenEMCocktailV2::CreateCocktail()
   SetMtScalingFactors();
   AliGenEMlibV2::SetPtParametrizations(fParametrizationFile, fParametrizationDir);
   SetPtParametrizations();
+  if (fUseLookupTables) AliGenEMlibV2::FillLookupTables(fPtMin, fPtMax);
   
   // Create and add electron sources to the generator
   // pizero
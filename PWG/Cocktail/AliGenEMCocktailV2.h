@@ -58,6 +58,7 @@ public:
   void    SetCentrality(AliGenEMlibV2::Centrality_t cent)             { fCentrality = cent;               }
   void    SetV2Systematic(AliGenEMlibV2::v2Sys_t v2sys)               { fV2Systematic = v2sys;            }
   void    SetForceGammaConversion(Bool_t force=kTRUE)                 { fForceConv=force;                 }
+  void    SetUseLookupTables(Bool_t useTables=kTRUE)                  { fUseLookupTables=useTables;       }
   void    SetHeaviestHadron(ParticleGenerator_t part);
   static  Bool_t  SetPtParametrizations();
   static  void    SetMtScalingFactors();
@@ -118,8 +119,9 @@ private:
   
   Bool_t        fForceConv;                             // select whether you want to force all gammas to convert imidediately
   UInt_t        fSelectedParticles;                     // which particles to simulate, allows to switch on and off 32 different particles
+  Bool_t        fUseLookupTables;                       // tabulate pt parametrizations and v2 instead of evaluating them for each particle
   
-  ClassDef(AliGenEMCocktailV2,5)       // cocktail for EM physics
+  ClassDef(AliGenEMCocktailV2,6)       // cocktail for EM physics
 };
 
 #endif
@@ -46,6 +46,13 @@ TH1D* AliGenEMlibV2::fMtFactorHisto             = NULL;
 Int_t AliGenEMlibV2::fgSelectedCollisionsSystem = AliGenEMlibV2::kpp7TeV;
 Int_t AliGenEMlibV2::fgSelectedCentrality       = AliGenEMlibV2::kpp;
 Int_t AliGenEMlibV2::fgSelectedV2Systematic     = AliGenEMlibV2::kNoV2Sys;
+Bool_t   AliGenEMlibV2::fgLookupTablesFilled    = kFALSE;
+Double_t AliGenEMlibV2::fgLookupPtMin           = 0.;
+Double_t AliGenEMlibV2::fgLookupPtMax           = 0.;
+Double_t AliGenEMlibV2::fgLookupV2PtMax         = 0.;
+Bool_t   AliGenEMlibV2::fgPtLookupValid[]       = {kFALSE};
+Double_t AliGenEMlibV2::fgPtLookup[18][AliGenEMlibV2::fgkNLookup+1];
+Double_t AliGenEMlibV2::fgV2PizeroLookup[AliGenEMlibV2::fgkNLookup+1];
 
 Double_t AliGenEMlibV2::CrossOverLc(double a, double b, double x){
   if(x<b-a/2) return 1.0;
@@ -268,7 +275,7 @@ Int_t AliGenEMlibV2::IpPizero(TRandom *)
 Double_t AliGenEMlibV2::PtPizero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPizero]->Eval(pt);
+  return EvalPtParametrization(kPizero, pt);
 }
 
 Double_t AliGenEMlibV2::YPizero( const Double_t *py, const Double_t */*dummy*/ )
@@ -278,6 +285,12 @@ Double_t AliGenEMlibV2::YPizero( const Double_t *py, const Double_t */*dummy*/ )
 
 Double_t AliGenEMlibV2::V2Pizero( const Double_t *px, const Double_t */*dummy*/ )
 {
+  if (fgLookupTablesFilled && px[0] >= 0. && px[0] < fgLookupV2PtMax) {
+    Double_t x  = px[0]/fgLookupV2PtMax*fgkNLookup;
+    Int_t    i  = (Int_t)x;
+    return fgV2PizeroLookup[i] + (x-i)*(fgV2PizeroLookup[i+1]-fgV2PizeroLookup[i]);
+  }
+
   double n1,n2,n3,n4,n5;
   double v1,v2,v3,v4,v5;
   switch(fgSelectedCollisionsSystem|fgSelectedCentrality) {
@@ -340,7 +353,7 @@ Int_t AliGenEMlibV2::IpEta(TRandom *)
 Double_t AliGenEMlibV2::PtEta( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEta]->Eval(pt);
+  return EvalPtParametrization(kEta, pt);
 }
 
 Double_t AliGenEMlibV2::YEta( const Double_t *py, const Double_t */*dummy*/ )
@@ -368,7 +381,7 @@ Int_t AliGenEMlibV2::IpRho0(TRandom *)
 Double_t AliGenEMlibV2::PtRho0( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRho0]->Eval(pt);
+  return EvalPtParametrization(kRho0, pt);
 }
 
 Double_t AliGenEMlibV2::YRho0( const Double_t *py, const Double_t */*dummy*/ )
@@ -396,7 +409,7 @@ Int_t AliGenEMlibV2::IpOmega(TRandom *)
 Double_t AliGenEMlibV2::PtOmega( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmega]->Eval(pt);
+  return EvalPtParametrization(kOmega, pt);
 }
 
 Double_t AliGenEMlibV2::YOmega( const Double_t *py, const Double_t */*dummy*/ )
@@ -425,7 +438,7 @@ Int_t AliGenEMlibV2::IpEtaprime(TRandom *)
 Double_t AliGenEMlibV2::PtEtaprime( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEtaprime]->Eval(pt);
+  return EvalPtParametrization(kEtaprime, pt);
 }
 
 Double_t AliGenEMlibV2::YEtaprime( const Double_t *py, const Double_t */*dummy*/ )
@@ -454,7 +467,7 @@ Int_t AliGenEMlibV2::IpPhi(TRandom *)
 Double_t AliGenEMlibV2::PtPhi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPhi]->Eval(pt);
+  return EvalPtParametrization(kPhi, pt);
 }
 
 Double_t AliGenEMlibV2::YPhi( const Double_t *py, const Double_t */*dummy*/ )
@@ -482,7 +495,7 @@ Int_t AliGenEMlibV2::IpJpsi(TRandom *)
 Double_t AliGenEMlibV2::PtJpsi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kJpsi]->Eval(pt);
+  return EvalPtParametrization(kJpsi, pt);
 }
 
 Double_t AliGenEMlibV2::YJpsi( const Double_t *py, const Double_t */*dummy*/ )
@@ -520,7 +533,7 @@ Int_t AliGenEMlibV2::IpSigma(TRandom *)
 Double_t AliGenEMlibV2::PtSigma( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigma0]->Eval(pt);
+  return EvalPtParametrization(kSigma0, pt);
 }
 
 Double_t AliGenEMlibV2::YSigma( const Double_t *py, const Double_t */*dummy*/ )
@@ -549,7 +562,7 @@ Int_t AliGenEMlibV2::IpK0short(TRandom *)
 Double_t AliGenEMlibV2::PtK0short( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0s]->Eval(pt);
+  return EvalPtParametrization(kK0s, pt);
 }
 
 Double_t AliGenEMlibV2::YK0short( const Double_t *py, const Double_t */*dummy*/ )
@@ -578,7 +591,7 @@ Int_t AliGenEMlibV2::IpK0long(TRandom *)
 Double_t AliGenEMlibV2::PtK0long( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0l]->Eval(pt);
+  return EvalPtParametrization(kK0l, pt);
 }
 
 Double_t AliGenEMlibV2::YK0long( const Double_t *py, const Double_t */*dummy*/ )
@@ -607,7 +620,7 @@ Int_t AliGenEMlibV2::IpLambda(TRandom *)
 Double_t AliGenEMlibV2::PtLambda( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kLambda]->Eval(pt);
+  return EvalPtParametrization(kLambda, pt);
 }
 
 Double_t AliGenEMlibV2::YLambda( const Double_t *py, const Double_t */*dummy*/ )
@@ -636,7 +649,7 @@ Int_t AliGenEMlibV2::IpDeltaPlPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPlPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPlPl]->Eval(pt);
+  return EvalPtParametrization(kDeltaPlPl, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPlPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -665,7 +678,7 @@ Int_t AliGenEMlibV2::IpDeltaPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPl]->Eval(pt);
+  return EvalPtParametrization(kDeltaPl, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -694,7 +707,7 @@ Int_t AliGenEMlibV2::IpDeltaMi(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaMi]->Eval(pt);
+  return EvalPtParametrization(kDeltaMi, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -723,7 +736,7 @@ Int_t AliGenEMlibV2::IpDeltaZero(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaZero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaZero]->Eval(pt);
+  return EvalPtParametrization(kDeltaZero, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaZero( const Double_t *py, const Double_t */*dummy*/ )
@@ -752,7 +765,7 @@ Int_t AliGenEMlibV2::IpRhoPl(TRandom *)
 Double_t AliGenEMlibV2::PtRhoPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoPl]->Eval(pt);
+  return EvalPtParametrization(kRhoPl, pt);
 }
 
 Double_t AliGenEMlibV2::YRhoPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -781,7 +794,7 @@ Int_t AliGenEMlibV2::IpRhoMi(TRandom *)
 Double_t AliGenEMlibV2::PtRhoMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoMi]->Eval(pt);
+  return EvalPtParametrization(kRhoMi, pt);
 }
 
 Double_t AliGenEMlibV2::YRhoMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -810,7 +823,7 @@ Int_t AliGenEMlibV2::IpK0star(TRandom *)
 Double_t AliGenEMlibV2::PtK0star( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0star]->Eval(pt);
+  return EvalPtParametrization(kK0star, pt);
 }
 
 Double_t AliGenEMlibV2::YK0star( const Double_t *py, const Double_t */*dummy*/ )
@@ -1031,11 +1044,95 @@ Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
   
   fParametrizationFile->Close();
   delete fParametrizationFile;
+
+  fgLookupTablesFilled = kFALSE;
   
   return kTRUE;
 }
 
 
+//--------------------------------------------------------------------------
+//
+//                    lookup tables of pt and v2
+//
+//--------------------------------------------------------------------------
+void AliGenEMlibV2::FillLookupTables(Double_t ptMin, Double_t ptMax) {
+  // Tabulate the pt parametrizations on [ptMin,ptMax] and the pi0 v2 (used by
+  // all the mesons and baryons through KEt scaling) once per configuration.
+  // log(f/pt) is interpolated linearly for the pt spectra, which is smooth also
+  // at low pt, while the v2 is interpolated linearly. The tables are checked
+  // against the direct evaluation at the middle of each interval.
+
+  fgLookupTablesFilled  = kFALSE;
+  fgLookupPtMin         = ptMin;
+  fgLookupPtMax         = ptMax;
+  // KEt-scaled pt of the heavier particles can be slightly above the pi0 one
+  fgLookupV2PtMax       = ptMax + 1.;
+  const Double_t step   = (fgLookupPtMax-fgLookupPtMin)/fgkNLookup;
+  const Double_t stepV2 = fgLookupV2PtMax/fgkNLookup;
+  if (step <= 0.) {
+    AliErrorClass(Form("Invalid pt range %f-%f for the lookup tables", ptMin, ptMax));
+    return;
+  }
+
+  Double_t maxDevPt = 0.;
+  for (Int_t np=0; np<18; np++) {
+    fgPtLookupValid[np] = (fPtParametrization[np] != NULL);
+    for (Int_t i=0; i<=fgkNLookup && fgPtLookupValid[np]; i++) {
+      // node at pt=0 is only used for interpolation, avoid dividing by zero
+      Double_t pt   = TMath::Max(fgLookupPtMin + i*step, 1e-3*step);
+      Double_t val  = fPtParametrization[np]->Eval(pt);
+      if (val > 0.) fgPtLookup[np][i] = TMath::Log(val/pt);
+      else          fgPtLookupValid[np] = kFALSE;
+    }
+    if (!fgPtLookupValid[np] && fPtParametrization[np])
+      AliWarningClass(Form("Non positive pt parametrization for particle %d, lookup table not used", np));
+  }
+
+  // direct evaluation of the v2 as long as fgLookupTablesFilled is false
+  for (Int_t i=0; i<=fgkNLookup; i++) {
+    Double_t pt         = i*stepV2;
+    fgV2PizeroLookup[i] = V2Pizero(&pt, (Double_t*) 0);
+  }
+
+  Double_t maxDevV2 = 0.;
+  for (Int_t i=0; i<fgkNLookup; i++) {
+    Double_t pt     = (i+0.5)*stepV2;
+    Double_t direct = V2Pizero(&pt, (Double_t*) 0);
+    maxDevV2        = TMath::Max(maxDevV2, TMath::Abs(0.5*(fgV2PizeroLookup[i]+fgV2PizeroLookup[i+1]) - direct));
+  }
+
+  fgLookupTablesFilled = kTRUE;
+
+  for (Int_t np=0; np<18; np++) {
+    if (!fgPtLookupValid[np]) continue;
+    for (Int_t i=1; i<fgkNLookup; i++) {
+      Double_t pt     = fgLookupPtMin + (i+0.5)*step;
+      Double_t direct = fPtParametrization[np]->Eval(pt);
+      if (direct > 0.) maxDevPt = TMath::Max(maxDevPt, TMath::Abs(EvalPtParametrization(np, pt)/direct - 1.));
+    }
+  }
+
+  AliInfoClass(Form("Lookup tables filled for pt %f-%f GeV/c: max. relative deviation of pt parametrizations %g, max. deviation of v2 %g", ptMin, ptMax, maxDevPt, maxDevV2));
+  if (maxDevPt > 1e-3 || maxDevV2 > 1e-4)
+    AliWarningClass("Lookup tables deviate significantly from the parametrizations");
+}
+
+//--------------------------------------------------------------------------
+Double_t AliGenEMlibV2::EvalPtParametrization(Int_t np, Double_t pt) {
+  // pt parametrization of particle np, from the lookup table if available.
+  // The first interval is always evaluated directly, since f/pt is not
+  // defined at pt=0
+  if (fgLookupTablesFilled && fgPtLookupValid[np]) {
+    Double_t x = (pt-fgLookupPtMin)/(fgLookupPtMax-fgLookupPtMin)*fgkNLookup;
+    if (x >= 1. && x < fgkNLookup) {
+      Int_t i = (Int_t)x;
+      return pt*TMath::Exp(fgPtLookup[np][i] + (x-i)*(fgPtLookup[np][i+1]-fgPtLookup[np][i]));
+    }
+  }
+  return fPtParametrization[np]->Eval(pt);
+}
+
 //--------------------------------------------------------------------------
 //
 //                     return pt parametrization
@@ -51,6 +51,7 @@ public:
     fgSelectedCollisionsSystem  = collisionSystem;
     fgSelectedCentrality        = centSelect;
     fgSelectedV2Systematic      = v2sys;
+    fgLookupTablesFilled        = kFALSE;
   }
   
   GenFunc   GetPt(Int_t param, const char * tname=0) const;
@@ -63,6 +64,11 @@ public:
   static void   SetMtScalingFactors(TString fileName, TString dirName);
   static TF1*   GetPtParametrization(Int_t np);
   static TH1D*  GetMtScalingFactors();
+
+  // lookup tables of the pt parametrizations and of the pi0 v2, to be filled
+  // after the parametrizations are set (the direct evaluation is used outside the range)
+  static void   FillLookupTables(Double_t ptMin, Double_t ptMax);
+  static void   ResetLookupTables()                                     { fgLookupTablesFilled = kFALSE; }
   
   static Int_t fgSelectedCollisionsSystem;                                                      // selected pT parameter
   static Int_t fgSelectedCentrality;                                                            // selected Centrality
@@ -78,6 +84,7 @@ public:
   static Double_t V2Flat(const Double_t *px, const Double_t *param);
   static Double_t KEtScal(Double_t pt, Int_t np, Int_t nq=2);
   static Double_t GetTAA(Int_t cent);
+  static Double_t EvalPtParametrization(Int_t np, Double_t pt);
   
   static Double_t CrossOverLc(double a, double b, double x);
   static Double_t CrossOverRc(double a, double b, double x);
@@ -217,6 +224,15 @@ private:
   static TF1*     fPtParametrizationProton;   // pt paramtrization
   static TH1D*    fMtFactorHisto;             // mt scaling factors
 
+  static const Int_t fgkNLookup = 10000;                      // number of intervals of the lookup tables
+  static Bool_t   fgLookupTablesFilled;                       // lookup tables are filled and up to date
+  static Double_t fgLookupPtMin;                              // lower pt of the pt lookup tables
+  static Double_t fgLookupPtMax;                              // upper pt of the pt lookup tables
+  static Double_t fgLookupV2PtMax;                            // upper pt of the v2 lookup table
+  static Bool_t   fgPtLookupValid[18];                        // pt lookup table can be used
+  static Double_t fgPtLookup[18][fgkNLookup+1];               // log(parametrization/pt) at the nodes
+  static Double_t fgV2PizeroLookup[fgkNLookup+1];             // pi0 v2 at the nodes
+
   ClassDef(AliGenEMlibV2,5);
   
 };
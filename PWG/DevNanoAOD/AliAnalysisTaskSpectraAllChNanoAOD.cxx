@@ -49,6 +49,7 @@
 #include <iostream>
 #include "AliNanoAODHeader.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
 
 using namespace AliHelperPIDNameSpace;
 using namespace std;
@@ -69,7 +70,8 @@ AliAnalysisTaskSpectraAllChNanoAOD::AliAnalysisTaskSpectraAllChNanoAOD(const cha
   fOutput(0x0),
   fnCentBins(20),
   fnQvecBins(40),
-  fnNchBins(200)
+  fnNchBins(200),
+  fNanoColumns(0x0)
 {
   // Default constructor
   DefineInput(0, TChain::Class());
@@ -79,6 +81,13 @@ AliAnalysisTaskSpectraAllChNanoAOD::AliAnalysisTaskSpectraAllChNanoAOD(const cha
   DefineOutput(4, AliHelperPID::Class());
 }
 
+//________________________________________________________________________
+AliAnalysisTaskSpectraAllChNanoAOD::~AliAnalysisTaskSpectraAllChNanoAOD()
+{
+  // Destructor
+  delete fNanoColumns;
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskSpectraAllChNanoAOD::UserCreateOutputObjects()
 {
@@ -156,6 +165,15 @@ void AliAnalysisTaskSpectraAllChNanoAOD::UserCreateOutputObjects()
   NSparseHistEv->GetAxis(2)->SetName("N_ch");
   fOutput->Add(NSparseHistEv);
   
+  // columnar view of the nano tracks, nsigma columns in the order TPC pi,K,p, TOF pi,K,p
+  fNanoColumns = new AliNanoAODTrackColumns();
+  fNanoColumns->AddVariable("cstNSigmaTPCPi");
+  fNanoColumns->AddVariable("cstNSigmaTPCKa");
+  fNanoColumns->AddVariable("cstNSigmaTPCPr");
+  fNanoColumns->AddVariable("cstNSigmaTOFPi");
+  fNanoColumns->AddVariable("cstNSigmaTOFKa");
+  fNanoColumns->AddVariable("cstNSigmaTOFPr");
+  
   PostData(1, fOutput  );
   PostData(2, fEventCuts);
   PostData(3, fTrackCuts);
@@ -235,6 +253,11 @@ void AliAnalysisTaskSpectraAllChNanoAOD::UserExec(Option_t *)
 	}
     }
   
+  // copy the nano track variables used below into contiguous arrays
+  if(isNano && !fFillOnlyEvents) {
+    if(!fNanoColumns->Fill(fAOD)) AliFatal("The tracks of the nano AOD event are not nano AOD tracks");
+  }
+
   //main loop on tracks
   
   Int_t Nch = 0.;
@@ -247,7 +270,7 @@ void AliAnalysisTaskSpectraAllChNanoAOD::UserExec(Option_t *)
     }
     
     if(!fFillOnlyEvents){
-      Int_t IDrec=isNano ? GetNanoTrackID (track) : fHelperPID->GetParticleSpecies(track,kTRUE);//id from detector      
+      Int_t IDrec=isNano ? GetNanoTrackID (iTracks) : fHelperPID->GetParticleSpecies(track,kTRUE);//id from detector      
       Double_t y= 0;
       if(isNano) y = ((AliNanoAODTrack*)track)->Y(fHelperPID->GetMass((AliHelperParticleSpecies_t)IDrec));
       else y = ((AliAODTrack*)track)->Y(fHelperPID->GetMass((AliHelperParticleSpecies_t)IDrec));
@@ -313,6 +336,14 @@ void AliAnalysisTaskSpectraAllChNanoAOD::UserExec(Option_t *)
   PostData(4, fHelperPID);
 }
 
+//_________________________________________________________________
+Bool_t AliAnalysisTaskSpectraAllChNanoAOD::UserNotify()
+{
+  // New input file: the nano track mapping may have changed
+  if(fNanoColumns) fNanoColumns->ResetMapping();
+  return kTRUE;
+}
+
 //_________________________________________________________________
 void   AliAnalysisTaskSpectraAllChNanoAOD::Terminate(Option_t *)
 {
@@ -325,13 +356,27 @@ Int_t AliAnalysisTaskSpectraAllChNanoAOD::GetNanoTrackID(AliVTrack * track) {
   AliNanoAODTrack * nanoTrack = dynamic_cast<AliNanoAODTrack*>(track);
   if(!nanoTrack) AliFatal("Not a nano AOD track");
 
-  // Cache indexes
-  static const Int_t kcstNSigmaTPCPi  = AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstNSigmaTPCPi");
-  static const Int_t kcstNSigmaTPCKa  = AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstNSigmaTPCKa");
-  static const Int_t kcstNSigmaTPCPr  = AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstNSigmaTPCPr");
-  static const Int_t kcstNSigmaTOFPi  = AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstNSigmaTOFPi");
-  static const Int_t kcstNSigmaTOFKa  = AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstNSigmaTOFKa");
-  static const Int_t kcstNSigmaTOFPr  = AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstNSigmaTOFPr");
+  // Indexes resolved by the columnar view for the current file
+  const Int_t kFirst = AliNanoAODTrackColumns::kNStandardColumns;
+  Double_t nsigma[6];
+  for(Int_t i = 0; i < 6; i++) nsigma[i] = nanoTrack->GetVar(fNanoColumns->GetVarIndex(kFirst+i));
+
+  return GetNanoTrackID(nanoTrack->Pt(), nsigma);
+}
+
+Int_t AliAnalysisTaskSpectraAllChNanoAOD::GetNanoTrackID(Int_t iTrack) {
+  // Applies nsigma PID to the nano track iTrack of the current event, 
+  // reading the columnar view filled in UserExec
+
+  const Int_t kFirst = AliNanoAODTrackColumns::kNStandardColumns;
+  Double_t nsigma[6];
+  for(Int_t i = 0; i < 6; i++) nsigma[i] = fNanoColumns->GetValue(kFirst+i, iTrack);
+
+  return GetNanoTrackID(fNanoColumns->GetPt()[iTrack], nsigma);
+}
+
+Int_t AliAnalysisTaskSpectraAllChNanoAOD::GetNanoTrackID(Double_t pt, const Double_t * nsigma) {
+  // nsigma PID, nsigma in the order TPC pi,K,p, TOF pi,K,p
 
   Double_t nSigmaPID = 3.0;
 
@@ -339,15 +384,15 @@ Int_t AliAnalysisTaskSpectraAllChNanoAOD::GetNanoTrackID(AliVTrack * track) {
 
   //get the identity of the particle with the minimum Nsigma
   Double_t nsigmaPion=999., nsigmaKaon=999., nsigmaProton=999.;
-  if(nanoTrack->Pt() > fTrackCuts->GetPtTOFMatching()) {
-    nsigmaProton =  TMath::Sqrt(nanoTrack->GetVar(kcstNSigmaTPCPr)*nanoTrack->GetVar(kcstNSigmaTPCPr)+nanoTrack->GetVar(kcstNSigmaTOFPr)*nanoTrack->GetVar(kcstNSigmaTOFPr));
-    nsigmaKaon   =  TMath::Sqrt(nanoTrack->GetVar(kcstNSigmaTPCKa)*nanoTrack->GetVar(kcstNSigmaTPCKa)+nanoTrack->GetVar(kcstNSigmaTOFKa)*nanoTrack->GetVar(kcstNSigmaTOFKa));
-    nsigmaPion   =  TMath::Sqrt(nanoTrack->GetVar(kcstNSigmaTPCPi)*nanoTrack->GetVar(kcstNSigmaTPCPi)+nanoTrack->GetVar(kcstNSigmaTOFPi)*nanoTrack->GetVar(kcstNSigmaTOFPi));
+  if(pt > fTrackCuts->GetPtTOFMatching()) {
+    nsigmaProton =  TMath::Sqrt(nsigma[2]*nsigma[2]+nsigma[5]*nsigma[5]);
+    nsigmaKaon   =  TMath::Sqrt(nsigma[1]*nsigma[1]+nsigma[4]*nsigma[4]);
+    nsigmaPion   =  TMath::Sqrt(nsigma[0]*nsigma[0]+nsigma[3]*nsigma[3]);
   }
   else {
-    nsigmaProton =  TMath::Abs(nanoTrack->GetVar(kcstNSigmaTPCPr));
-    nsigmaKaon   =  TMath::Abs(nanoTrack->GetVar(kcstNSigmaTPCKa));  
-    nsigmaPion   =  TMath::Abs(nanoTrack->GetVar(kcstNSigmaTPCPi));  
+    nsigmaProton =  TMath::Abs(nsigma[2]);
+    nsigmaKaon   =  TMath::Abs(nsigma[1]);  
+    nsigmaPion   =  TMath::Abs(nsigma[0]);  
   }
 
   
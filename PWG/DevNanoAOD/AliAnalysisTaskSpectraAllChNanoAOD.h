@@ -16,6 +16,7 @@ class AliAODEvent;
 class AliSpectraAODTrackCuts;
 class AliSpectraAODEventCuts;
 class AliHelperPID;
+class AliNanoAODTrackColumns;
 
 #include "AliAnalysisTaskSE.h"
 
@@ -36,12 +37,11 @@ class AliAnalysisTaskSpectraAllChNanoAOD : public AliAnalysisTaskSE
     fOutput(0x0),
     fnCentBins(20),
     fnQvecBins(40),
-    fnNchBins(200)
+    fnNchBins(200),
+    fNanoColumns(0x0)
       {}
   AliAnalysisTaskSpectraAllChNanoAOD(const char *name);
-  virtual ~AliAnalysisTaskSpectraAllChNanoAOD() {
-    Printf("calling detructor of AliAnalysisTaskSpectraAllChNanoAOD - To be implemented");
-  }
+  virtual ~AliAnalysisTaskSpectraAllChNanoAOD();
   
   void SetIsMC(Bool_t isMC = kFALSE)    {fIsMC = isMC; };
   Bool_t GetIsMC()           const           { return fIsMC;};
@@ -60,6 +60,7 @@ class AliAnalysisTaskSpectraAllChNanoAOD : public AliAnalysisTaskSE
   
   virtual void   UserCreateOutputObjects();
   virtual void   UserExec(Option_t *option);
+  virtual Bool_t UserNotify();
   virtual void   Terminate(Option_t *);
   
   AliSpectraAODTrackCuts      * GetTrackCuts()         {  return fTrackCuts; }
@@ -76,9 +77,12 @@ class AliAnalysisTaskSpectraAllChNanoAOD : public AliAnalysisTaskSE
 
 
   Int_t GetNanoTrackID(AliVTrack * track) ;
+  Int_t GetNanoTrackID(Int_t iTrack) ; // uses the columnar view of the current event
   
  private:
   
+  Int_t GetNanoTrackID(Double_t pt, const Double_t * nsigma) ; // nsigma in the order TPC pi,K,p, TOF pi,K,p
+
   AliAODEvent                   * fAOD;                         //! AOD object
   AliSpectraAODTrackCuts      * fTrackCuts;                   // Track Cuts
   AliSpectraAODEventCuts      * fEventCuts;                   // Event Cuts
@@ -92,10 +96,11 @@ class AliAnalysisTaskSpectraAllChNanoAOD : public AliAnalysisTaskSE
   Int_t                            fnCentBins;                  // number of bins for the centrality axis
   Int_t                            fnQvecBins;                 // number of bins for the q vector axis
   Int_t                            fnNchBins;                 // number of bins for the Nch axis
+  AliNanoAODTrackColumns         * fNanoColumns;              //! columnar view of the nano tracks, nsigma columns in the order TPC pi,K,p, TOF pi,K,p
   AliAnalysisTaskSpectraAllChNanoAOD(const AliAnalysisTaskSpectraAllChNanoAOD&);
   AliAnalysisTaskSpectraAllChNanoAOD& operator=(const AliAnalysisTaskSpectraAllChNanoAOD&);
   
-  ClassDef(AliAnalysisTaskSpectraAllChNanoAOD, 6);
+  ClassDef(AliAnalysisTaskSpectraAllChNanoAOD, 7);
 };
 
 #endif
@@ -0,0 +1,128 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+
+//-------------------------------------------------------------------------
+//     Columnar view of the NanoAOD track branch
+//-------------------------------------------------------------------------
+
+#include <TObjString.h>
+#include <TMath.h>
+#include "AliLog.h"
+#include "AliVEvent.h"
+#include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackMapping.h"
+#include "AliNanoAODTrackColumns.h"
+
+ClassImp(AliNanoAODTrackColumns)
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::AliNanoAODTrackColumns() :
+  TObject(),
+  fVarNames(),
+  fMappingResolved(kFALSE),
+  fVarIndex(),
+  fNTracks(0),
+  fValues(),
+  fCharge()
+{
+  // default constructor
+  fVarNames.SetOwner(kTRUE);
+}
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::~AliNanoAODTrackColumns() 
+{
+  // destructor
+}
+
+//______________________________________________________________________________
+Int_t AliNanoAODTrackColumns::AddVariable(const char * varName) 
+{
+  // Request an additional variable, returns its column
+
+  for(Int_t ivar = 0; ivar < fVarNames.GetEntriesFast(); ivar++) {
+    if(!strcmp(fVarNames.UncheckedAt(ivar)->GetName(), varName)) return kNStandardColumns + ivar;
+  }
+  fVarNames.Add(new TObjString(varName));
+  fMappingResolved = kFALSE; // force the indices to be resolved again
+
+  return kNStandardColumns + fVarNames.GetEntriesFast() - 1;
+}
+
+//______________________________________________________________________________
+Int_t AliNanoAODTrackColumns::GetVarIndex(Int_t column) 
+{
+  // Index in the track storage of a column (-1 for eta, computed from theta),
+  // to read single tracks with the indices resolved for the current file
+
+  if(!fMappingResolved) ResolveMapping();
+  return fVarIndex[column];
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::ResolveMapping() 
+{
+  // Resolve the storage index of each column for the mapping of the current file
+
+  AliNanoAODTrackMapping * mapping = AliNanoAODTrackMapping::GetInstance();
+  if(!mapping) AliFatal("No nano AOD track mapping available");
+
+  fMappingResolved = kTRUE;
+  fVarIndex.resize(GetNColumns());
+  fVarIndex[kPt]    = mapping->GetPt();
+  fVarIndex[kPhi]   = mapping->GetPhi();
+  fVarIndex[kTheta] = mapping->GetTheta();
+  fVarIndex[kEta]   = -1; // computed from theta
+  for(Int_t ivar = 0; ivar < fVarNames.GetEntriesFast(); ivar++) {
+    fVarIndex[kNStandardColumns+ivar] = mapping->GetVarIndex(fVarNames.UncheckedAt(ivar)->GetName());
+    if(fVarIndex[kNStandardColumns+ivar] < 0) {
+      AliFatal(Form("Variable %s not found in the track mapping", fVarNames.UncheckedAt(ivar)->GetName()));
+    }
+  }
+}
+
+//______________________________________________________________________________
+Bool_t AliNanoAODTrackColumns::Fill(AliVEvent * event) 
+{
+  // Copy the variables of all the tracks of the event into the columns.
+  // Returns false (and leaves the view empty) if the event does not contain nano tracks.
+
+  fNTracks = 0;
+  Int_t nTracks = event->GetNumberOfTracks();
+  if(!nTracks) return kTRUE;
+
+  if(!dynamic_cast<AliNanoAODTrack*>(event->GetTrack(0))) return kFALSE;
+
+  if(!fMappingResolved) ResolveMapping();
+
+  Int_t nColumns = GetNColumns();
+  fNTracks = nTracks;
+  fValues.resize(nColumns*nTracks);
+  fCharge.resize(nTracks);
+
+  const Int_t * varIndex = &fVarIndex[0];
+  for(Int_t iTrack = 0; iTrack < nTracks; iTrack++) {
+    AliNanoAODTrack * track = static_cast<AliNanoAODTrack*>(event->GetTrack(iTrack));
+    for(Int_t icol = 0; icol < nColumns; icol++) {
+      if(icol == kEta) continue;
+      fValues[icol*nTracks+iTrack] = track->GetVar(varIndex[icol]);
+    }
+    fValues[kEta*nTracks+iTrack] = -TMath::Log(TMath::Tan(0.5 * fValues[kTheta*nTracks+iTrack]));
+    fCharge[iTrack] = track->Charge();
+  }
+
+  return kTRUE;
+}
@@ -0,0 +1,75 @@
+#ifndef AliNanoAODTrackColumns_H
+#define AliNanoAODTrackColumns_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+
+//-------------------------------------------------------------------------
+//     Columnar view of the NanoAOD track branch
+//
+//     For each event, the requested track variables of all the
+//     AliNanoAODTrack's are copied into contiguous per-variable
+//     arrays (one value per track, in the order of the event). The
+//     indices of the variables in the track storage are resolved
+//     once per input file, instead of going through
+//     AliNanoAODTrackMapping::GetInstance() at every access. The user
+//     task calls ResetMapping() when a new file is opened (UserNotify).
+//
+//     pt, phi, theta, eta and the charge are always available. Other
+//     variables, including custom ones ("cst..."), are requested by name
+//     with AddVariable() before the first Fill() and read with
+//     GetColumn().
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include <TObject.h>
+#include <TObjArray.h>
+
+class AliVEvent;
+class AliNanoAODTrack;
+
+class AliNanoAODTrackColumns : public TObject {
+
+public:
+  
+  enum EStandardColumn { kPt = 0, kPhi, kTheta, kEta, kNStandardColumns };
+
+  AliNanoAODTrackColumns();
+  virtual ~AliNanoAODTrackColumns();
+
+  Int_t AddVariable(const char * varName);
+  Int_t GetNColumns() const { return kNStandardColumns + fVarNames.GetEntriesFast(); }
+
+  Bool_t Fill(AliVEvent * event);
+
+  Int_t GetNTracks() const { return fNTracks; }
+  const Double_t * GetColumn(Int_t column) const { return fNTracks ? &fValues[column*fNTracks] : 0; }
+  const Double_t * GetPt()     const { return GetColumn(kPt);    }
+  const Double_t * GetPhi()    const { return GetColumn(kPhi);   }
+  const Double_t * GetTheta()  const { return GetColumn(kTheta); }
+  const Double_t * GetEta()    const { return GetColumn(kEta);   }
+  const Short_t  * GetCharge() const { return fNTracks ? &fCharge[0] : 0; }
+
+  Double_t GetValue(Int_t column, Int_t iTrack) const { return fValues[column*fNTracks+iTrack]; }
+
+  void  ResetMapping() { fMappingResolved = kFALSE; } // to be called for each new input file
+  Int_t GetVarIndex(Int_t column);
+
+private:
+
+  AliNanoAODTrackColumns(const AliNanoAODTrackColumns&); // not implemented
+  AliNanoAODTrackColumns& operator=(const AliNanoAODTrackColumns&); // not implemented
+
+  void ResolveMapping();
+
+  TObjArray                     fVarNames;      // names of the additional variables (TObjString)
+  Bool_t                        fMappingResolved; //! fVarIndex resolved for the current input file
+  std::vector<Int_t>            fVarIndex;      //! index in the track storage of each column (except eta)
+  Int_t                         fNTracks;       //! number of tracks in the current event
+  std::vector<Double_t>         fValues;        //! column values, column c of track i at c*fNTracks+i
+  std::vector<Short_t>          fCharge;        //! track charges
+
+  ClassDef(AliNanoAODTrackColumns, 1);
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include <TMath.h>
 #include <TRandom.h>
 #include <TChain.h>
+#include <TEnv.h>
 #include <TGrid.h>
 #include <TSystem.h>
 #include <TUUID.h>
@@ -51,6 +52,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPtHardBin(-1),
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kFALSE),
+  fPrefetchInput(kFALSE),
+  fTreeCacheSize(0),
   fFilePattern(""),
   fFileListFilename(""),
   fFilenameIndex(-1),
@@ -65,6 +68,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fOffset(0),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
+  fPrefetchedTreeNumber(-1),
   fInitializedEmbedding(false),
   fInitializedNewFile(false),
   fWrappedAroundTree(false),
@@ -91,6 +95,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPtHardBin(-1),
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kFALSE),
+  fPrefetchInput(kFALSE),
+  fTreeCacheSize(0),
   fFilePattern(""),
   fFileListFilename(""),
   fFilenameIndex(-1),
@@ -105,6 +111,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fOffset(0),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
+  fPrefetchedTreeNumber(-1),
   fInitializedEmbedding(false),
   fInitializedNewFile(false),
   fWrappedAroundTree(false),
@@ -554,6 +561,9 @@ void AliAnalysisTaskEmcalEmbeddingHelper::SetupEmbedding()
   // Get file list
   GetFilenames();
 
+  // Setup asynchronous reading. It must be enabled before the files are opened
+  SetupPrefetching();
+
   // Setup TChain
   Bool_t res = SetupInputFiles();
   if (!res) { return; }
@@ -590,6 +600,13 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   // Fine to be += as long as we started at 0
   fUpperEntry += fChain->GetTree()->GetEntries();
 
+  // Attach the cache to the new tree and start opening the file after it
+  if (fPrefetchInput) {
+    if (fTreeCacheSize > 0) fChain->SetCacheSize(fTreeCacheSize);
+    fChain->AddBranchToCache("*", kTRUE);
+    PrefetchNextFile();
+  }
+
   // Jump ahead at random if desired
   // Determines the offset into the tree
   if (fRandomEventNumberAccess) {
@@ -620,6 +637,61 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   fInitializedNewFile = kTRUE;
 }
 
+/**
+ * Setup the read-ahead of the embedded events. The baskets of all the branches of the TChain are
+ * read through a TTreeCache, and the file after the current one in the TChain is opened in advance
+ * (see PrefetchNextFile()). If EnableAsyncPrefetching() was called, the TTreeCache is filled by
+ * the ROOT prefetching thread while the current event is being processed.
+ *
+ * The entries are still read in exactly the same order, so the random file and random entry
+ * access modes, as well as the event selection in IsEventSelected(), are unaffected.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::SetupPrefetching()
+{
+  if (!fPrefetchInput) return;
+
+  AliInfo(TString::Format("Read-ahead of the embedded events enabled (TTreeCache size %lld, asynchronous prefetching %s)!",
+                          fTreeCacheSize, gEnv->GetValue("TFile.AsyncPrefetching", 0) ? "on" : "off"));
+}
+
+/**
+ * Let ROOT fill the TTreeCache of the files with a separate prefetching thread (TFile.AsyncPrefetching).
+ *
+ * NOTE: This is a global setting of the process, which applies to all the files opened afterwards,
+ * including the main input of the train. It is therefore never changed by the task itself, but must
+ * be requested explicitly, e.g. in the AddTask macro, before the files are opened.
+ *
+ * @param[in] enable If true, asynchronous prefetching is enabled
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::EnableAsyncPrefetching(Bool_t enable)
+{
+  ::Info("AliAnalysisTaskEmcalEmbeddingHelper::EnableAsyncPrefetching", "Setting TFile.AsyncPrefetching to %d for all the files of the process", enable ? 1 : 0);
+  gEnv->SetValue("TFile.AsyncPrefetching", enable ? 1 : 0);
+}
+
+/**
+ * Start opening the file that follows the current one in the TChain. When the TChain moves to
+ * the next tree, TFile::Open() picks up the pending request instead of opening the file again,
+ * so the latency of opening the file (on AliEn in particular) is hidden behind the processing of
+ * the current one. After the last file, the TChain restarts from the beginning (see GetNextEntry()),
+ * so the first file is prefetched.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::PrefetchNextFile()
+{
+  Int_t currentTreeNumber = fChain->GetTreeNumber();
+  Int_t nextTreeNumber = currentTreeNumber + 1;
+  if (nextTreeNumber >= fMaxNumberOfFiles) nextTreeNumber = 0;
+
+  if (nextTreeNumber == currentTreeNumber || nextTreeNumber == fPrefetchedTreeNumber) return;
+
+  TObject *element = fChain->GetListOfFiles()->At(nextTreeNumber);
+  if (!element) return;
+
+  AliDebug(2, TString::Format("Opening file %s in advance", element->GetTitle()));
+  TFile::AsyncOpen(element->GetTitle());
+  fPrefetchedTreeNumber = nextTreeNumber;
+}
+
 /**
  * Run the main analysis code here. If for some reason the embedding was not successfully set up
  * in UserCreateOutputObjects(), it is set up against before continuing. It also ensures that the
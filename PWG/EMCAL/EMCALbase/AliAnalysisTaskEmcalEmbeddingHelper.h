@@ -80,6 +80,9 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t GetRandomFileAccess()                              const { return fRandomFileAccess; }
   TString GetFilePattern()                                  const { return fFilePattern; }
   Int_t GetStartingFileIndex()                              const { return fFilenameIndex; }
+  /// Read the embedded events through a TTreeCache and open the next file in advance
+  Bool_t GetPrefetchInput()                                 const { return fPrefetchInput; }
+  Long64_t GetTreeCacheSize()                               const { return fTreeCacheSize; }
   TString GetFileListFilename()                             const { return fFileListFilename; }
 
   void SetESD(const char * treeName = "esdTree")                  { fTreeName     = treeName; }
@@ -88,6 +91,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetRandomFileAccess(Bool_t b)                              { fRandomFileAccess = b; }
   void SetFilePattern(const char * pattern)                       { fFilePattern = pattern; }
   void SetStartingFileIndex(Int_t n)                              { fFilenameIndex = n; }
+  void SetPrefetchInput(Bool_t b, Long64_t cacheSize = 100000000) { fPrefetchInput = b; fTreeCacheSize = cacheSize; }
   void SetFileListFilename(const char * filename)                 { fFileListFilename = filename; }
 
   UInt_t GetTriggerMask()                                   const { return fTriggerMask; }
@@ -99,6 +103,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetMaxVertexDistance(Double_t distance)                    { fMaxVertexDist = distance; }
 
   static AliAnalysisTaskEmcalEmbeddingHelper * AddTaskEmcalEmbeddingHelper();
+  static void EnableAsyncPrefetching(Bool_t enable = kTRUE);
 
  protected:
   void            GetFilenames()        ;
@@ -109,6 +114,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          IsEventSelected()     ;
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
+  void            SetupPrefetching()    ;
+  void            PrefetchNextFile()    ;
 
   UInt_t                                        fTriggerMask;       ///<  Trigger selection mask
   Double_t                                      fZVertexCut;        ///<  Z vertex cut on embedded event
@@ -123,6 +130,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t                                         fPtHardBin        ; ///<  ptHard bin for the given pythia production
   Bool_t                                        fRandomEventNumberAccess; ///<  If true, it will start embedding from a random entry in the file rather than from the first
   Bool_t                                        fRandomFileAccess ; ///< If true, it will start embedding from a random file in the input files list
+  Bool_t                                        fPrefetchInput    ; ///<  If true, the embedded events are read through a TTreeCache and the next file is opened in advance
+  Long64_t                                      fTreeCacheSize    ; ///<  Size of the TTreeCache of the embedding TChain (only with fPrefetchInput)
 
   TString                                       fFilePattern      ; ///<  File pattern to select AliEn files
   TString                                       fFileListFilename ; ///<  Name of the file list containing paths to files to embed
@@ -136,6 +145,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t                                         fOffset           ; //!<! Offset from fLowerEntry where the loop over the tree should start
   Int_t                                         fMaxNumberOfFiles ; //!<! Max number of files that are in the TChain
   Int_t                                         fFileNumber       ; //!<! File number corresponding to the current tree
+  Int_t                                         fPrefetchedTreeNumber; //!<! Tree number in the TChain of the file which is being opened in advance
   AliVEvent                                    *fExternalEvent    ; //!<! Current external event available for embedding
 
   static AliAnalysisTaskEmcalEmbeddingHelper   *fgInstance        ; //!<! Global instance of this class
@@ -145,7 +155,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 1);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 2);
   /// \endcond
 };
 #endif
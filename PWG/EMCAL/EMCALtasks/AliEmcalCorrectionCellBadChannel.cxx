@@ -134,3 +134,45 @@ Bool_t AliEmcalCorrectionCellBadChannel::CheckIfRunChanged()
   }
   return runChanged;
 }
+
+/**
+ * Fused cell calibration: check the run and fill the "before" QA.
+ *
+ * @return kTRUE if the run changed, so that the calibration table must be rebuilt
+ */
+Bool_t AliEmcalCorrectionCellBadChannel::BeginCellCalib()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  Bool_t runChanged = CheckIfRunChanged();
+
+  fRecoUtils->SwitchOnBadChannelsRemoval();
+
+  if(fCreateHisto)
+    FillCellQA(fCellEnergyDistBefore); // "before" QA
+
+  return runChanged;
+}
+
+/**
+ * Fused cell calibration: mark the bad channels in the calibration table.
+ */
+void AliEmcalCorrectionCellBadChannel::FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table)
+{
+  table.fRemoveBadChannels = kTRUE;
+
+  Int_t iSM = -1, iCol = -1, iRow = -1;
+  for (Int_t absId = 0; absId < table.GetNCells(); absId++) {
+    if (!GetCellIndexesInSModule(absId, iSM, iCol, iRow)) continue;
+    if (fRecoUtils->GetEMCALChannelStatus(iSM, iCol, iRow)) table.fBadChannel[absId] = 1;
+  }
+}
+
+/**
+ * Fused cell calibration: fill the "after" QA.
+ */
+void AliEmcalCorrectionCellBadChannel::EndCellCalib()
+{
+  if(fCreateHisto)
+    FillCellQA(fCellEnergyDistAfter); // "after" QA
+}
@@ -120,6 +120,52 @@ Bool_t AliEmcalCorrectionCellEnergy::Run()
   return kTRUE;
 }
 
+/**
+ * Fused cell calibration: check the run and fill the "before" QA.
+ *
+ * @return kTRUE if the run changed, so that the calibration table must be rebuilt
+ */
+Bool_t AliEmcalCorrectionCellEnergy::BeginCellCalib()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  Bool_t runChanged = CheckIfRunChanged();
+
+  fRecoUtils->SwitchOnRecalibration();
+
+  if(fCreateHisto)
+    FillCellQA(fCellEnergyDistBefore); // "before" QA
+
+  return runChanged;
+}
+
+/**
+ * Fused cell calibration: multiply the energy factors of the calibration table by the
+ * (temperature corrected) recalibration factors.
+ */
+void AliEmcalCorrectionCellEnergy::FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table)
+{
+  table.fRecalibrateEnergy = kTRUE;
+
+  Int_t iSM = -1, iCol = -1, iRow = -1;
+  for (Int_t absId = 0; absId < table.GetNCells(); absId++) {
+    if (!GetCellIndexesInSModule(absId, iSM, iCol, iRow)) continue;
+    table.fEnergyFactor[absId] *= fRecoUtils->GetEMCALChannelRecalibrationFactor(iSM, iCol, iRow);
+  }
+}
+
+/**
+ * Fused cell calibration: fill the "after" QA.
+ */
+void AliEmcalCorrectionCellEnergy::EndCellCalib()
+{
+  if(fCreateHisto)
+    FillCellQA(fCellEnergyDistAfter); // "after" QA
+
+  // switch off recalibrations so those are not done multiple times
+  fRecoUtils->SwitchOffRecalibration();
+}
+
 /**
  * Initialize the energy calibration.
  */
@@ -32,6 +32,12 @@ class AliEmcalCorrectionCellEnergy : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Fused cell calibration
+  Bool_t IsCellCalibComponent() const { return kTRUE; }
+  Bool_t BeginCellCalib();
+  void FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table);
+  void EndCellCalib();
   
 protected:
   TH1F* fCellEnergyDistBefore;        //!<! cell energy distribution, before energy calibration
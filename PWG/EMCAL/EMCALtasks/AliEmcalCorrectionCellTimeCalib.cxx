@@ -127,6 +127,68 @@ Bool_t AliEmcalCorrectionCellTimeCalib::Run()
   return kTRUE;
 }
 
+/**
+ * Fused cell calibration: check the run, configure the reco utils and fill the "before" QA.
+ *
+ * @return kTRUE if the run changed, so that the calibration table must be rebuilt
+ */
+Bool_t AliEmcalCorrectionCellTimeCalib::BeginCellCalib()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  Bool_t runChanged = CheckIfRunChanged();
+
+  if (fCalibrateTime)
+    fRecoUtils->SwitchOnTimeRecalibration();
+  else
+    fRecoUtils->SwitchOffTimeRecalibration();
+
+  if (fCalibrateTimeL1Phase)
+    fRecoUtils->SwitchOnL1PhaseInTimeRecalibration();
+  else
+    fRecoUtils->SwitchOffL1PhaseInTimeRecalibration();
+
+  if(fCreateHisto)
+    FillCellQA(fCellTimeDistBefore); // "before" QA
+
+  return runChanged;
+}
+
+/**
+ * Fused cell calibration: add the time offsets for each bunch crossing phase to the calibration table.
+ * The offsets are obtained by calibrating a zero time through AliEMCALRecoUtils, so that they include
+ * the L1 phase correction when it is enabled.
+ */
+void AliEmcalCorrectionCellTimeCalib::FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table)
+{
+  if (!fCalibrateTime) return;
+
+  table.fRecalibrateTime = kTRUE;
+
+  // mark the cells not recalibrated, otherwise the reco utils do not apply the calibration
+  fRecoUtils->ResetCellsCalibrated();
+
+  Int_t iSM = -1, iCol = -1, iRow = -1;
+  for (Int_t absId = 0; absId < table.GetNCells(); absId++) {
+    if (!GetCellIndexesInSModule(absId, iSM, iCol, iRow)) continue;
+    for (Int_t ibc = 0; ibc < AliEmcalCorrectionCellCalibTable::fgkNBunchCrossPhases; ibc++) {
+      Double_t offset = 0;
+      fRecoUtils->RecalibrateCellTime(absId, ibc, offset);
+      fRecoUtils->RecalibrateCellTimeL1Phase(iSM, ibc, offset);
+      table.fTimeOffset[ibc][absId] += offset;
+    }
+  }
+}
+
+/**
+ * Fused cell calibration: fill the "after" QA.
+ */
+void AliEmcalCorrectionCellTimeCalib::EndCellCalib()
+{
+  if(fCreateHisto)
+    FillCellQA(fCellTimeDistAfter); // "after" QA
+}
+
 /**
  * Initialize the time calibration.
  */
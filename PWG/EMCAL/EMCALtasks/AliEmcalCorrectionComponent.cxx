@@ -15,6 +15,7 @@
 #include "AliParticleContainer.h"
 #include "AliMCParticleContainer.h"
 #include "AliOADBContainer.h"
+#include "AliVCaloCells.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionComponent);
@@ -206,6 +207,90 @@ void AliEmcalCorrectionComponent::UpdateCells()
   fCaloCells->Sort();
 }
 
+/**
+ * Get the supermodule, column (eta) and row (phi) indexes of a cell, as needed
+ * to access the calibration maps in AliEMCALRecoUtils.
+ *
+ * @param[in] absId Absolute ID of the cell
+ * @param[out] iSM Supermodule number
+ * @param[out] iCol Column (eta) index in the supermodule
+ * @param[out] iRow Row (phi) index in the supermodule
+ *
+ * @return kTRUE if absId is a valid cell ID
+ */
+Bool_t AliEmcalCorrectionComponent::GetCellIndexesInSModule(Int_t absId, Int_t & iSM, Int_t & iCol, Int_t & iRow) const
+{
+  Int_t iTower = -1, iIphi = -1, iIeta = -1;
+  if (!fGeom->GetCellIndex(absId, iSM, iTower, iIphi, iIeta)) return kFALSE;
+  fGeom->GetCellPhiEtaIndexInSModule(iSM, iTower, iIphi, iIeta, iRow, iCol);
+  return kTRUE;
+}
+
+/**
+ * Default constructor: no correction enabled
+ */
+AliEmcalCorrectionCellCalibTable::AliEmcalCorrectionCellCalibTable() :
+  fRemoveBadChannels(kFALSE),
+  fRecalibrateEnergy(kFALSE),
+  fRecalibrateTime(kFALSE),
+  fBadChannel(),
+  fEnergyFactor()
+{
+}
+
+/**
+ * Reset the table to the identity calibration for nCells cells.
+ *
+ * @param[in] nCells Number of cells of the detector
+ */
+void AliEmcalCorrectionCellCalibTable::Reset(Int_t nCells)
+{
+  fRemoveBadChannels = kFALSE;
+  fRecalibrateEnergy = kFALSE;
+  fRecalibrateTime = kFALSE;
+  fBadChannel.assign(nCells, 0);
+  fEnergyFactor.assign(nCells, 1.);
+  for (Int_t ibc = 0; ibc < fgkNBunchCrossPhases; ibc++) fTimeOffset[ibc].assign(nCells, 0.);
+}
+
+/**
+ * Apply all the enabled corrections to the cells in a single pass. Bad cells get E = 0 and t = -1,
+ * as in AliEMCALRecoUtils::RecalibrateCells(). The cells are modified in place, so that the following
+ * components (e.g. the clusterizer) see the calibrated cells.
+ *
+ * @param[in,out] cells Cells to be calibrated
+ * @param[in] bunchCrossNo Bunch crossing number of the event (selects the time calibration)
+ */
+void AliEmcalCorrectionCellCalibTable::Apply(AliVCaloCells * cells, Int_t bunchCrossNo) const
+{
+  const Int_t nCells = GetNCells();
+  const UChar_t * badChannel = fRemoveBadChannels ? &fBadChannel[0] : 0;
+  const Float_t * energyFactor = fRecalibrateEnergy ? &fEnergyFactor[0] : 0;
+  const Double_t * timeOffset = (fRecalibrateTime && bunchCrossNo >= 0) ? &fTimeOffset[bunchCrossNo % fgkNBunchCrossPhases][0] : 0;
+
+  Short_t  absId  =-1;
+  Double_t ecell = 0;
+  Double_t tcell = 0;
+  Double_t efrac = 0;
+  Int_t  mclabel = -1;
+
+  for (Int_t iCell = 0; iCell < cells->GetNumberOfCells(); iCell++) {
+    cells->GetCell(iCell, absId, ecell, tcell, mclabel, efrac);
+    if (absId < 0 || absId >= nCells) continue;
+
+    if (badChannel && badChannel[absId]) {
+      ecell = 0;
+      tcell = -1;
+    }
+    else {
+      if (energyFactor) ecell *= energyFactor[absId];
+      if (timeOffset) tcell += timeOffset[absId];
+    }
+
+    cells->SetCell(iCell, absId, ecell, tcell, mclabel, efrac, cells->GetCellHighGain(iCell));
+  }
+}
+
 /**
  * Check whether the run changed.
  */
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 // CINT can't handle the yaml header!
 #if !(defined(__CINT__) || defined(__MAKECINT__))
@@ -26,6 +27,36 @@ class AliVEvent;
 #include "AliClusterContainer.h"
 #include "AliEMCALGeometry.h"
 
+/**
+ * @class AliEmcalCorrectionCellCalibTable
+ * @ingroup EMCALCOREFW
+ * @brief Dense per-run cell calibration used by the fused cell corrections
+ *
+ * Bad channel mask, energy calibration factor and time offset (for each of the
+ * four bunch crossing phases) of each cell, indexed by the cell absolute ID.
+ * The table is filled by the cell correction components when the run changes
+ * and then applied to all of the cells in a single pass
+ * (see AliEmcalCorrectionTask::SetFuseCellCorrections()).
+ */
+class AliEmcalCorrectionCellCalibTable {
+ public:
+  AliEmcalCorrectionCellCalibTable();
+
+  void Reset(Int_t nCells);
+  void Apply(AliVCaloCells * cells, Int_t bunchCrossNo) const;
+
+  Int_t GetNCells() const { return fBadChannel.size(); }
+
+  static const Int_t fgkNBunchCrossPhases = 4;   ///< Number of bunch crossing phases of the time calibration
+
+  Bool_t                  fRemoveBadChannels;     ///< Whether bad channels are removed
+  Bool_t                  fRecalibrateEnergy;     ///< Whether the cell energy is recalibrated
+  Bool_t                  fRecalibrateTime;       ///< Whether the cell time is recalibrated
+  std::vector<UChar_t>    fBadChannel;            ///< Bad channel mask
+  std::vector<Float_t>    fEnergyFactor;          ///< Energy calibration factor
+  std::vector<Double_t>   fTimeOffset[fgkNBunchCrossPhases]; ///< Time offset to be added to the cell time, for each bunch crossing phase
+};
+
 /**
  * @class AliEmcalCorrectionComponent
  * @ingroup EMCALCOREFW
@@ -57,8 +88,19 @@ class AliEmcalCorrectionComponent : public TNamed {
   virtual Bool_t UserNotify();
   virtual Bool_t CheckIfRunChanged();
   
+  // Fused cell calibration (see AliEmcalCorrectionTask::SetFuseCellCorrections())
+  /// True if the component can be run as part of the fused cell calibration
+  virtual Bool_t IsCellCalibComponent() const { return kFALSE; }
+  /// Prepare the component for the fused pass. Returns true if the calibration table must be rebuilt
+  virtual Bool_t BeginCellCalib() { return kFALSE; }
+  /// Add the calibration of this component to the table
+  virtual void FillCellCalibTable(AliEmcalCorrectionCellCalibTable & /*table*/) {}
+  /// Called after the fused pass
+  virtual void EndCellCalib() {}
+
   void GetEtaPhiDiff(const AliVTrack *t, const AliVCluster *v, Double_t &phidiff, Double_t &etadiff);
   void UpdateCells();
+  Bool_t GetCellIndexesInSModule(Int_t absId, Int_t & iSM, Int_t & iCol, Int_t & iRow) const;
   void GetPass();
   void FillCellQA(TH1F* h);
   Int_t InitBadChannels();
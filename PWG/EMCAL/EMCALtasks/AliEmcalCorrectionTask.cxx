@@ -82,6 +82,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask() :
   fNVertCont(0),
   fBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
+  fFuseCellCorrections(kFALSE),
   fGeom(0),
   fParticleCollArray(),
   fClusterCollArray(),
@@ -130,6 +131,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const char * name) :
   fNVertCont(0),
   fBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
+  fFuseCellCorrections(kFALSE),
   fGeom(0),
   fParticleCollArray(),
   fClusterCollArray(),
@@ -178,6 +180,7 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const AliEmcalCorrectionTask & ta
   fBeamType(task.fBeamType),
   fForceBeamType(task.fForceBeamType),
   fNeedEmcalGeom(task.fNeedEmcalGeom),
+  fFuseCellCorrections(task.fFuseCellCorrections),
   fGeom(task.fGeom),
   fParticleCollArray(*(static_cast<TObjArray *>(task.fParticleCollArray.Clone()))),
   fClusterCollArray(*(static_cast<TObjArray *>(task.fClusterCollArray.Clone()))),
@@ -244,6 +247,7 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
   swap(first.fBeamType, second.fBeamType);
   swap(first.fForceBeamType, second.fForceBeamType);
   swap(first.fNeedEmcalGeom, second.fNeedEmcalGeom);
+  swap(first.fFuseCellCorrections, second.fFuseCellCorrections);
   swap(first.fGeom, second.fGeom);
   swap(first.fParticleCollArray, second.fParticleCollArray);
   swap(first.fClusterCollArray, second.fClusterCollArray);
@@ -1334,8 +1338,26 @@ Bool_t AliEmcalCorrectionTask::Run()
     component->SetMCEvent(MCEvent());
     component->SetCentralityBin(fCentBin);
     component->SetCentrality(fCent);
+  }
+
+  auto componentIt = fCorrectionComponents.cbegin();
+  while (componentIt != fCorrectionComponents.cend())
+  {
+    if (!fFuseCellCorrections || !(*componentIt)->IsCellCalibComponent()) {
+      (*componentIt)->Run();
+      componentIt++;
+      continue;
+    }
+
+    // Consecutive cell calibration components acting on the same cells are run together
+    auto groupEnd = componentIt + 1;
+    while (groupEnd != fCorrectionComponents.cend() && (*groupEnd)->IsCellCalibComponent() &&
+           (*groupEnd)->GetCaloCells() == (*componentIt)->GetCaloCells()) {
+      groupEnd++;
+    }
 
-    component->Run();
+    RunFusedCellCalib(componentIt, groupEnd);
+    componentIt = groupEnd;
   }
 
   PostData(1, fOutput);
@@ -1343,6 +1365,58 @@ Bool_t AliEmcalCorrectionTask::Run()
   return kTRUE;
 }
 
+/**
+ * Run a group of cell calibration components (bad channel removal, energy and time calibration)
+ * in a single pass over the cells. The calibration of all of the components of the group is
+ * collected in a dense per-cell table, which is only rebuilt when the run changes.
+ * The QA histograms of the components are filled before and after the whole group.
+ *
+ * @param[in] begin First component of the group
+ * @param[in] end End of the group
+ */
+void AliEmcalCorrectionTask::RunFusedCellCalib(std::vector <AliEmcalCorrectionComponent *>::const_iterator begin, std::vector <AliEmcalCorrectionComponent *>::const_iterator end)
+{
+  AliVCaloCells * cells = (*begin)->GetCaloCells();
+  if (!fGeom || !cells) {
+    // Cannot build the table, so fall back to the standard sequential processing
+    for (auto componentIt = begin; componentIt != end; componentIt++)
+    {
+      (*componentIt)->Run();
+    }
+    return;
+  }
+
+  AliEmcalCorrectionCellCalibTable & table = fCellCalibTables[*begin];
+
+  bool rebuildTable = (table.GetNCells() == 0);
+  for (auto componentIt = begin; componentIt != end; componentIt++)
+  {
+    if ((*componentIt)->BeginCellCalib()) rebuildTable = true;
+  }
+
+  if (rebuildTable) {
+    AliDebug(2, Form("Rebuilding fused cell calibration table starting with component %s", (*begin)->GetName()));
+    table.Reset(fGeom->GetNCells());
+    for (auto componentIt = begin; componentIt != end; componentIt++)
+    {
+      (*componentIt)->FillCellCalibTable(table);
+    }
+  }
+
+  if (cells->GetNumberOfCells() <= 0) {
+    AliDebug(2, Form("Number of EMCAL cells = %d, returning", cells->GetNumberOfCells()));
+    return;
+  }
+
+  table.Apply(cells, InputEvent()->GetBunchCrossNumber());
+  cells->Sort();
+
+  for (auto componentIt = begin; componentIt != end; componentIt++)
+  {
+    (*componentIt)->EndCellCalib();
+  }
+}
+
 /**
  * Executed when the file is changed. Also calls UserNotify() for each component.
  */
@@ -6,12 +6,14 @@
 #include <yaml-cpp/yaml.h>
 #endif
 
+class AliEmcalCorrectionCellCalibTable;
 class AliEmcalCorrectionCellContainer;
 class AliEmcalCorrectionComponent;
 class AliEMCALGeometry;
 class AliVEvent;
 
 #include <iosfwd>
+#include <map>
 
 #include <AliAnalysisTaskSE.h>
 #include <AliVCluster.h>
@@ -97,6 +99,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Set
   void                        SetForceBeamType(BeamType f)                          { fForceBeamType     = f                              ; }
   void                        SetNeedEmcalGeometry(Bool_t b)                        { fNeedEmcalGeom = b; }
+  void                        SetFuseCellCorrections(Bool_t b)                      { fFuseCellCorrections = b; }
   // Centrality options
   void                        SetUseNewCentralityEstimation(Bool_t b)               { fUseNewCentralityEstimation = b                     ; }
   virtual void                SetNCentBins(Int_t n)                                 { fNcentBins         = n                              ; }
@@ -167,6 +170,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Execute component functions
   void UserCreateOutputObjectsComponents();
   void ExecOnceComponents();
+  void RunFusedCellCalib(std::vector <AliEmcalCorrectionComponent *>::const_iterator begin, std::vector <AliEmcalCorrectionComponent *>::const_iterator end);
 
   // Initialization functions
   void InitializeConfiguration();
@@ -199,6 +203,8 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Hidden from CINT since it cannot handle YAML objects well
   YAML::Node                  fUserConfiguration;          //!<! User YAML Configuration
   YAML::Node                  fDefaultConfiguration;       //!<! Default YAML Configuration
+  // Calibration tables of the fused cell corrections, indexed by the first component of each group
+  std::map <AliEmcalCorrectionComponent *, AliEmcalCorrectionCellCalibTable> fCellCalibTables; //!<! Fused cell calibration tables
 #endif
 
   std::string                 fSuffix;                     ///< Suffix of the Correction Task (used to select components)
@@ -226,6 +232,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   BeamType                    fBeamType;                   //!<! Event beam type
   BeamType                    fForceBeamType;              ///< forced beam type
   Bool_t                      fNeedEmcalGeom;              ///< whether or not the task needs the emcal geometry
+  Bool_t                      fFuseCellCorrections;        ///< Run consecutive cell calibration components in a single pass over the cells
   AliEMCALGeometry           *fGeom;                       //!<! Emcal geometry
 
   TObjArray                   fParticleCollArray;          ///< Particle/track collection array
@@ -235,7 +242,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   TList *                     fOutput;                     //!<! Output for histograms
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionTask, 4); // EMCal correction task
+  ClassDef(AliEmcalCorrectionTask, 5); // EMCal correction task
   /// \endcond
 };
 
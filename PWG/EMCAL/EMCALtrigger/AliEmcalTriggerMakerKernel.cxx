@@ -32,6 +32,7 @@
 #include "AliEMCALTriggerRawPatch.h"
 #include "AliEmcalTriggerMakerKernel.h"
 #include "AliEmcalTriggerSetupInfo.h"
+#include "AliEmcalTriggerSummedAreaTable.h"
 #include "AliLog.h"
 #include "AliVCaloCells.h"
 #include "AliVCaloTrigger.h"
@@ -65,6 +66,8 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fSmearModelMean(nullptr),
   fSmearModelSigma(nullptr),
   fSmearThreshold(0.1),
+  fUseSummedAreaTables(kFALSE),
+  fL1AlgorithmSetups(),
   fGeometry(nullptr),
   fPatchAmplitudes(nullptr),
   fPatchADCSimple(nullptr),
@@ -72,8 +75,13 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
+  fTableAmplitudes(nullptr),
+  fTableADCSimple(nullptr),
+  fTableADC(nullptr),
+  fTableEnergySimpleSmeared(nullptr),
   fADCtoGeV(1.)
 {
+  memset(fL0AlgorithmSetup, 0, sizeof(UInt_t) * kNSetupEntries);
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
   memset(fL1ThresholdsOffline, 0, sizeof(ULong64_t) * 4);
   fCellTimeLimits[0] = -10000.;
@@ -87,6 +95,10 @@ AliEmcalTriggerMakerKernel::~AliEmcalTriggerMakerKernel() {
   delete fPatchEnergySimpleSmeared;
   delete fLevel0TimeMap;
   delete fTriggerBitMap;
+  delete fTableAmplitudes;
+  delete fTableADCSimple;
+  delete fTableADC;
+  delete fTableEnergySimpleSmeared;
   delete fPatchFinder;
   delete fLevel0PatchFinder;
   if(fTriggerBitConfig) delete fTriggerBitConfig;
@@ -128,6 +140,9 @@ void AliEmcalTriggerMakerKernel::AddL1TriggerAlgorithm(Int_t rowmin, Int_t rowma
   trigger->SetPatchSize(patchSize);
   trigger->SetSubregionSize(subregionSize);
   fPatchFinder->AddTriggerAlgorithm(trigger);
+
+  UInt_t setup[kNSetupEntries] = {static_cast<UInt_t>(rowmin), static_cast<UInt_t>(rowmax), bitmask, static_cast<UInt_t>(patchSize), static_cast<UInt_t>(subregionSize)};
+  fL1AlgorithmSetups.insert(fL1AlgorithmSetups.end(), setup, setup + kNSetupEntries);
 }
 
 void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize)
@@ -136,6 +151,12 @@ void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowma
   fLevel0PatchFinder = new AliEMCALTriggerAlgorithm<double>(rowmin, rowmax, bitmask);
   fLevel0PatchFinder->SetPatchSize(patchSize);
   fLevel0PatchFinder->SetSubregionSize(subregionSize);
+
+  fL0AlgorithmSetup[kSetupRowMin] = rowmin;
+  fL0AlgorithmSetup[kSetupRowMax] = rowmax;
+  fL0AlgorithmSetup[kSetupBitmask] = bitmask;
+  fL0AlgorithmSetup[kSetupPatchSize] = patchSize;
+  fL0AlgorithmSetup[kSetupSubregionSize] = subregionSize;
 }
 
 void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
@@ -146,6 +167,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSetups.clear();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -163,6 +185,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2015()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSetups.clear();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -180,6 +203,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPPb2013()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSetups.clear();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -195,6 +219,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2012()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSetups.clear();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -210,6 +235,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2011()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSetups.clear();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -225,6 +251,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2011()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSetups.clear();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   fConfigured = true;
@@ -487,8 +514,16 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   bkgPatchMask = 1 << fTriggerBitConfig->GetBkgBit();
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
+  if (fUseSummedAreaTables) BuildSummedAreaTables(useL0amp);
+
   std::vector<AliEMCALTriggerRawPatch> patches;
-  if (fPatchFinder) {
+  if (fUseSummedAreaTables) {
+    const AliEmcalTriggerSummedAreaTable *adctable = useL0amp ? fTableAmplitudes : fTableADC;
+    for (std::vector<UInt_t>::size_type ialgo = 0; ialgo + kNSetupEntries <= fL1AlgorithmSetups.size(); ialgo += kNSetupEntries) {
+      FindPatchesSummedArea(&fL1AlgorithmSetups[ialgo], *adctable, *fTableADCSimple, patches);
+    }
+  }
+  else if (fPatchFinder) {
     if (useL0amp) {
       patches = fPatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
     }
@@ -530,12 +565,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch);
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch.SetSmearedEnergy(energysmear);
     }
@@ -544,7 +574,10 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
 
   // Find Level0 patches
   std::vector<AliEMCALTriggerRawPatch> l0patches;
-  if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
+  if (fUseSummedAreaTables) {
+    if (fL0AlgorithmSetup[kSetupPatchSize]) FindPatchesSummedArea(fL0AlgorithmSetup, *fTableAmplitudes, *fTableADCSimple, l0patches);
+  }
+  else if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
   for(std::vector<AliEMCALTriggerRawPatch>::iterator patchit = l0patches.begin(); patchit != l0patches.end(); ++patchit){
     Int_t offlinebits = 0, onlinebits = 0;
     if(HasPHOSOverlap(*patchit)) continue;
@@ -561,12 +594,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch);
       fullpatch.SetSmearedEnergy(energysmear);
     }
     outputcont.push_back(fullpatch);
@@ -574,6 +602,55 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   // std::cout << "Finished finding trigger patches" << std::endl;
 }
 
+void AliEmcalTriggerMakerKernel::BuildSummedAreaTables(Bool_t useL0amp){
+  if (!fTableAmplitudes) fTableAmplitudes = new AliEmcalTriggerSummedAreaTable;
+  if (!fTableADCSimple) fTableADCSimple = new AliEmcalTriggerSummedAreaTable;
+  if (!fTableADC) fTableADC = new AliEmcalTriggerSummedAreaTable;
+
+  // L0 patches always use the L0 amplitudes, L1 patches depending on useL0amp
+  fTableAmplitudes->Build(*fPatchAmplitudes);
+  fTableADCSimple->Build(*fPatchADCSimple);
+  if (!useL0amp) fTableADC->Build(*fPatchADC);
+  if (fPatchEnergySimpleSmeared) {
+    if (!fTableEnergySimpleSmeared) fTableEnergySimpleSmeared = new AliEmcalTriggerSummedAreaTable;
+    fTableEnergySimpleSmeared->Build(*fPatchEnergySimpleSmeared);
+  }
+}
+
+void AliEmcalTriggerMakerKernel::FindPatchesSummedArea(const UInt_t *setup, const AliEmcalTriggerSummedAreaTable &adc,
+    const AliEmcalTriggerSummedAreaTable &offlineAdc, std::vector<AliEMCALTriggerRawPatch> &result) const {
+  const Int_t patchsize = setup[kSetupPatchSize], subregion = setup[kSetupSubregionSize];
+  if (patchsize < 1 || subregion < 1) return;
+  const Int_t rowStartMax = static_cast<Int_t>(setup[kSetupRowMax]) - (patchsize - 1),
+              colStartMax = adc.GetNumberOfCols() - patchsize;
+  for (int irow = setup[kSetupRowMin]; irow <= rowStartMax; irow += subregion) {
+    for (int icol = 0; icol <= colStartMax; icol += subregion) {
+      double sumadc = adc.GetSum(icol, irow, patchsize, patchsize),
+             sumofflineAdc = offlineAdc.GetSum(icol, irow, patchsize, patchsize);
+      // With non-negative entries a patch is above 0 exactly when it contains a
+      // non-zero FastOR, which does not depend on the rounding of the sums.
+      bool hasadc = adc.HasNegativeEntries() ? sumadc > 0 : adc.GetNumberOfNonZero(icol, irow, patchsize, patchsize) > 0,
+           hasofflineAdc = offlineAdc.HasNegativeEntries() ? sumofflineAdc > 0 : offlineAdc.GetNumberOfNonZero(icol, irow, patchsize, patchsize) > 0;
+      if (!hasadc && !hasofflineAdc) continue;
+      AliEMCALTriggerRawPatch recpatch(icol, irow, patchsize, sumadc, sumofflineAdc);
+      recpatch.SetBitmask(setup[kSetupBitmask]);
+      result.push_back(recpatch);
+    }
+  }
+}
+
+Double_t AliEmcalTriggerMakerKernel::GetSmearedPatchEnergy(const AliEMCALTriggerPatchInfo &patch) const {
+  if (fUseSummedAreaTables && fTableEnergySimpleSmeared)
+    return fTableEnergySimpleSmeared->GetSum(patch.GetColStart(), patch.GetRowStart(), patch.GetPatchSize(), patch.GetPatchSize());
+
+  double energysmear = 0;
+  for(int icol = 0; icol < patch.GetPatchSize(); icol++){
+    for(int irow = 0; irow < patch.GetPatchSize(); irow++){
+      energysmear += (*fPatchEnergySimpleSmeared)(patch.GetColStart() + icol, patch.GetRowStart() + irow);
+    }
+  }
+  return energysmear;
+}
 
 double AliEmcalTriggerMakerKernel::GetTriggerChannelADC(Int_t col, Int_t row) const{
   double adc = 0;
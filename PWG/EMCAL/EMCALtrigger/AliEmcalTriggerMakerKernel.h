@@ -15,6 +15,7 @@ class TF1;
 class TObjArray;
 class AliEMCALTriggerPatchInfo;
 class AliEMCALTriggerRawPatch;
+class AliEmcalTriggerSummedAreaTable;
 class AliEMCALGeometry;
 class AliVCaloCells;
 class AliVCaloTrigger;
@@ -361,6 +362,18 @@ public:
    */
   void SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize);
 
+  /**
+   * @brief Find the patches from summed-area tables of the data grids
+   *
+   * Summed-area tables of the FastOR data grids are built once per event,
+   * and the sums of all patches of all L0 and L1 algorithms are obtained
+   * from them in constant time per patch, instead of summing all FastORs
+   * of each patch for each algorithm. The patch lists are the same as
+   * the ones of the patch finders.
+   * @param[in] doUse If true the summed-area tables are used
+   */
+  void SetUseSummedAreaTables(Bool_t doUse = kTRUE) { fUseSummedAreaTables = doUse; }
+
   /**
    * @brief Set energy-dependent models for gaussian energy smearing
    * @param[in] mean Parameterization of the mean
@@ -421,6 +434,45 @@ protected:
     kColsEta = 48
   };
 
+  /**
+   * @brief Entries of the algorithm setups kept for the summed-area patch finding
+   */
+  enum{
+    kSetupRowMin = 0,
+    kSetupRowMax,
+    kSetupBitmask,
+    kSetupPatchSize,
+    kSetupSubregionSize,
+    kNSetupEntries
+  };
+
+  /**
+   * @brief Build the summed-area tables of the data grids used by the patch finding
+   * @param[in] useL0amp if true the Level0 amplitude is used for the L1 patches
+   */
+  void BuildSummedAreaTables(Bool_t useL0amp);
+
+  /**
+   * @brief Find the patches of one algorithm from the summed-area tables
+   *
+   * Patch positions, sums and selection are the same as the ones of
+   * AliEMCALTriggerAlgorithm::FindPatches for the (default) 0 thresholds
+   * of the algorithms created by the trigger maker kernel.
+   * @param[in] setup Algorithm setup (kNSetupEntries entries)
+   * @param[in] adc Table of the ADC grid
+   * @param[in] offlineAdc Table of the offline ADC grid
+   * @param[out] result List the patches are appended to
+   */
+  void FindPatchesSummedArea(const UInt_t *setup, const AliEmcalTriggerSummedAreaTable &adc,
+      const AliEmcalTriggerSummedAreaTable &offlineAdc, std::vector<AliEMCALTriggerRawPatch> &result) const;
+
+  /**
+   * @brief Smeared energy of a patch
+   * @param[in] patch Patch for which the smeared energy is summed
+   * @return Sum of the smeared energies of the FastORs of the patch
+   */
+  Double_t GetSmearedPatchEnergy(const AliEMCALTriggerPatchInfo &patch) const;
+
   /**
    * @brief Accept trigger patch as Level0 patch.
    *
@@ -484,6 +536,9 @@ protected:
   TF1                                       *fSmearModelMean;             ///< Smearing parameterization for the mean
   TF1                                       *fSmearModelSigma;            ///< Smearing parameterization for the width
   Double_t                                  fSmearThreshold;              ///< Smear threshold: Only cell energies above threshold are smeared
+  Bool_t                                    fUseSummedAreaTables;         ///< Find the patches from summed-area tables of the data grids
+  std::vector<UInt_t>                       fL1AlgorithmSetups;           ///< Setups of the L1 algorithms, kNSetupEntries entries per algorithm
+  UInt_t                                    fL0AlgorithmSetup[kNSetupEntries];  ///< Setup of the L0 algorithm (patch size 0 if not set)
 
   const AliEMCALGeometry                    *fGeometry;                   //!<! Underlying EMCAL geometry
   AliEMCALTriggerDataGrid<double>           *fPatchAmplitudes;            //!<! TRU Amplitudes (for L0)
@@ -492,11 +547,15 @@ protected:
   AliEMCALTriggerDataGrid<double>           *fPatchEnergySimpleSmeared;   //!<! Data grid for smeared energy values from cell energies
   AliEMCALTriggerDataGrid<char>             *fLevel0TimeMap;              //!<! Map needed to store the level0 times
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
+  AliEmcalTriggerSummedAreaTable            *fTableAmplitudes;            //!<! Summed-area table of the TRU amplitudes
+  AliEmcalTriggerSummedAreaTable            *fTableADCSimple;             //!<! Summed-area table of the offline ADC values
+  AliEmcalTriggerSummedAreaTable            *fTableADC;                   //!<! Summed-area table of the ADC values
+  AliEmcalTriggerSummedAreaTable            *fTableEnergySimpleSmeared;   //!<! Summed-area table of the smeared energies
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
   /// \endcond
 };
 
@@ -0,0 +1,82 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include "AliEMCALTriggerDataGrid.h"
+#include "AliEmcalTriggerSummedAreaTable.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalTriggerSummedAreaTable)
+/// \endcond
+
+AliEmcalTriggerSummedAreaTable::AliEmcalTriggerSummedAreaTable():
+  TObject(),
+  fNCols(0),
+  fNRows(0),
+  fHasNegative(kFALSE),
+  fSums(),
+  fNonZero()
+{
+}
+
+void AliEmcalTriggerSummedAreaTable::Build(const AliEMCALTriggerDataGrid<double> &grid){
+  fNCols = grid.GetNumberOfCols();
+  fNRows = grid.GetNumberOfRows();
+  fHasNegative = kFALSE;
+
+  const int stride = fNCols + 1;
+  fSums.assign(stride * (fNRows + 1), 0.);
+  fNonZero.assign(stride * (fNRows + 1), 0);
+
+  // Entry (col, row) holds the sum over all grid entries with
+  // smaller column and smaller row. First row and column stay 0.
+  for(int irow = 0; irow < fNRows; irow++){
+    double rowsum = 0;
+    int rownonzero = 0;
+    for(int icol = 0; icol < fNCols; icol++){
+      double value = grid(icol, irow);
+      if(value < 0) fHasNegative = kTRUE;
+      rowsum += value;
+      if(value != 0) rownonzero++;
+      fSums[(irow + 1) * stride + icol + 1] = fSums[irow * stride + icol + 1] + rowsum;
+      fNonZero[(irow + 1) * stride + icol + 1] = fNonZero[irow * stride + icol + 1] + rownonzero;
+    }
+  }
+}
+
+Bool_t AliEmcalTriggerSummedAreaTable::ClipWindow(Int_t &colmin, Int_t &rowmin, Int_t &colmax, Int_t &rowmax) const {
+  if(colmin < 0) colmin = 0;
+  if(rowmin < 0) rowmin = 0;
+  if(colmax > fNCols) colmax = fNCols;
+  if(rowmax > fNRows) rowmax = fNRows;
+  return colmin < colmax && rowmin < rowmax;
+}
+
+Double_t AliEmcalTriggerSummedAreaTable::GetSum(Int_t col, Int_t row, Int_t ncols, Int_t nrows) const {
+  Int_t colmin = col, rowmin = row, colmax = col + ncols, rowmax = row + nrows;
+  if(!ClipWindow(colmin, rowmin, colmax, rowmax)) return 0.;
+  const int stride = fNCols + 1;
+  // empty windows are exactly 0, independently of the rounding of the table
+  if(fNonZero[rowmax * stride + colmax] - fNonZero[rowmin * stride + colmax]
+     - fNonZero[rowmax * stride + colmin] + fNonZero[rowmin * stride + colmin] == 0) return 0.;
+  return fSums[rowmax * stride + colmax] - fSums[rowmin * stride + colmax]
+       - fSums[rowmax * stride + colmin] + fSums[rowmin * stride + colmin];
+}
+
+Int_t AliEmcalTriggerSummedAreaTable::GetNumberOfNonZero(Int_t col, Int_t row, Int_t ncols, Int_t nrows) const {
+  Int_t colmin = col, rowmin = row, colmax = col + ncols, rowmax = row + nrows;
+  if(!ClipWindow(colmin, rowmin, colmax, rowmax)) return 0;
+  const int stride = fNCols + 1;
+  return fNonZero[rowmax * stride + colmax] - fNonZero[rowmin * stride + colmax]
+       - fNonZero[rowmax * stride + colmin] + fNonZero[rowmin * stride + colmin];
+}
@@ -0,0 +1,92 @@
+#ifndef ALIEMCALTRIGGERSUMMEDAREATABLE_H
+#define ALIEMCALTRIGGERSUMMEDAREATABLE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+
+#include <TObject.h>
+
+template<class T> class AliEMCALTriggerDataGrid;
+
+/**
+ * @class AliEmcalTriggerSummedAreaTable
+ * @brief Summed-area table of an EMCAL trigger data grid
+ * @ingroup EMCALTRGFW
+ *
+ * The table contains for each (col, row) the sum of all grid entries
+ * with smaller column and row, so that the sum over any rectangular
+ * window of the grid is obtained from four entries of the table,
+ * independently of the window size. The number of non-zero grid
+ * entries is tabulated in the same way, which tells exactly whether
+ * a window is empty.
+ *
+ * The table is built once per event from the filled data grid and
+ * can then be queried for all patch sizes of all trigger algorithms.
+ */
+class AliEmcalTriggerSummedAreaTable : public TObject {
+public:
+
+  /**
+   * @brief Constructor
+   */
+  AliEmcalTriggerSummedAreaTable();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliEmcalTriggerSummedAreaTable() {}
+
+  /**
+   * @brief Build the table from the content of a data grid
+   * @param[in] grid Filled data grid
+   */
+  void Build(const AliEMCALTriggerDataGrid<double> &grid);
+
+  /**
+   * @brief Sum of the grid entries in a window
+   *
+   * Parts of the window outside the grid do not contribute, windows
+   * without non-zero entries give exactly 0.
+   * @param[in] col First column of the window
+   * @param[in] row First row of the window
+   * @param[in] ncols Number of columns of the window
+   * @param[in] nrows Number of rows of the window
+   * @return Sum of the grid entries in the window
+   */
+  Double_t GetSum(Int_t col, Int_t row, Int_t ncols, Int_t nrows) const;
+
+  /**
+   * @brief Number of non-zero grid entries in a window
+   * @param[in] col First column of the window
+   * @param[in] row First row of the window
+   * @param[in] ncols Number of columns of the window
+   * @param[in] nrows Number of rows of the window
+   * @return Number of non-zero entries in the window
+   */
+  Int_t GetNumberOfNonZero(Int_t col, Int_t row, Int_t ncols, Int_t nrows) const;
+
+  /**
+   * @brief Check whether the grid had negative entries
+   * @return True if at least one entry of the grid was negative
+   */
+  Bool_t HasNegativeEntries() const { return fHasNegative; }
+
+  Int_t GetNumberOfCols() const { return fNCols; }
+  Int_t GetNumberOfRows() const { return fNRows; }
+
+protected:
+  Bool_t ClipWindow(Int_t &colmin, Int_t &rowmin, Int_t &colmax, Int_t &rowmax) const;
+
+  Int_t                   fNCols;             ///< Number of columns of the grid
+  Int_t                   fNRows;             ///< Number of rows of the grid
+  Bool_t                  fHasNegative;       ///< Grid had negative entries
+  std::vector<Double_t>   fSums;              //!<! Sums, (fNCols+1) x (fNRows+1) entries, row major
+  std::vector<Int_t>      fNonZero;           //!<! Number of non-zero entries, same layout
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTriggerSummedAreaTable, 1);
+  /// \endcond
+};
+
+#endif
@@ -8,6 +8,7 @@
 #pragma link C++ class AliEmcalTriggerMakerKernel+;
 #pragma link C++ class AliEmcalTriggerMakerTask+;
 #pragma link C++ class AliEmcalTriggerSetupInfo+;
+#pragma link C++ class AliEmcalTriggerSummedAreaTable+;
 #pragma link C++ class AliEmcalTriggerDecision+;
 #pragma link C++ class AliEmcalTriggerDecisionContainer+;
 #pragma link C++ class AliEmcalTriggerSelectionCuts++;
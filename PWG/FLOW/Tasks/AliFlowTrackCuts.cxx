@@ -81,6 +81,9 @@ using std::endl;
 
 ClassImp(AliFlowTrackCuts)
 
+const Double_t AliFlowTrackCuts::fgkPurityMapRange = 3.;
+const Double_t AliFlowTrackCuts::fgkPurityMapStep = 0.1;
+
 //-----------------------------------------------------------------------
 AliFlowTrackCuts::AliFlowTrackCuts():
   AliFlowTrackSimpleCuts(),
@@ -141,8 +144,6 @@ AliFlowTrackCuts::AliFlowTrackCuts():
   fCutTPCSecbound(kFALSE),
   fCutTPCSecboundMinpt(0.2),
   fCutTPCSecboundVar(kFALSE),
-  fPhiCutLow(NULL),
-  fPhiCutHigh(NULL),
   fLinearizeVZEROresponse(kFALSE),
   fCentralityPercentileMin(0.),
   fCentralityPercentileMax(5.),
@@ -203,6 +204,8 @@ AliFlowTrackCuts::AliFlowTrackCuts():
   fNsigmaCut2(9),
   fPurityFunctionsFile(0),
   fPurityFunctionsList(0),
+  fPurityMap(),
+  fPurityMapTolerance(),
   fCutITSclusterShared(kFALSE),
   fMaxITSclusterShared(0),
   fCutITSChi2(kFALSE),
@@ -226,9 +229,6 @@ AliFlowTrackCuts::AliFlowTrackCuts():
   for(Int_t i(0) ; i < 180; i++) {
      fPurityFunction[i]=NULL;
   }
-
-  fPhiCutLow = new TF1("fPhiCutLow",  "0.1/x/x+pi/18.0-0.025", 0, 100);
-  fPhiCutHigh = new TF1("fPhiCutHigh", "0.12/x+pi/18.0+0.035", 0, 100);
 }
 
 //-----------------------------------------------------------------------
@@ -291,8 +291,6 @@ AliFlowTrackCuts::AliFlowTrackCuts(const char* name):
   fCutTPCSecbound(kFALSE),
   fCutTPCSecboundMinpt(0.2),
   fCutTPCSecboundVar(kFALSE),
-  fPhiCutLow(NULL),
-  fPhiCutHigh(NULL),
   fLinearizeVZEROresponse(kFALSE),
   fCentralityPercentileMin(0.),
   fCentralityPercentileMax(5.),
@@ -353,6 +351,8 @@ AliFlowTrackCuts::AliFlowTrackCuts(const char* name):
   fNsigmaCut2(9),
   fPurityFunctionsFile(0),
   fPurityFunctionsList(0),
+  fPurityMap(),
+  fPurityMapTolerance(),
   fCutITSclusterShared(kFALSE),
   fMaxITSclusterShared(0),
   fCutITSChi2(kFALSE),
@@ -379,9 +379,6 @@ AliFlowTrackCuts::AliFlowTrackCuts(const char* name):
   for(int i=0;i<180;i++){
      fPurityFunction[i]=NULL;
   }
-
-  fPhiCutLow = new TF1("fPhiCutLow",  "0.1/x/x+pi/18.0-0.025", 0, 100);
-  fPhiCutHigh = new TF1("fPhiCutHigh", "0.12/x+pi/18.0+0.035", 0, 100);
 }
 
 //-----------------------------------------------------------------------
@@ -444,8 +441,6 @@ AliFlowTrackCuts::AliFlowTrackCuts(const AliFlowTrackCuts& that):
   fCutTPCSecbound(that.fCutTPCSecbound),
   fCutTPCSecboundMinpt(that.fCutTPCSecboundMinpt),
   fCutTPCSecboundVar(that.fCutTPCSecboundVar),
-  fPhiCutLow(NULL),
-  fPhiCutHigh(NULL),
   fLinearizeVZEROresponse(that.fLinearizeVZEROresponse),
   fCentralityPercentileMin(that.fCentralityPercentileMin),
   fCentralityPercentileMax(that.fCentralityPercentileMax),
@@ -506,6 +501,8 @@ AliFlowTrackCuts::AliFlowTrackCuts(const AliFlowTrackCuts& that):
   fNsigmaCut2(that.fNsigmaCut2),
   fPurityFunctionsFile(that.fPurityFunctionsFile),
   fPurityFunctionsList(that.fPurityFunctionsList),
+  fPurityMap(that.fPurityMap),
+  fPurityMapTolerance(that.fPurityMapTolerance),
   fCutITSclusterShared(kFALSE),
   fMaxITSclusterShared(0),
   fCutITSChi2(kFALSE),
@@ -541,9 +538,6 @@ AliFlowTrackCuts::AliFlowTrackCuts(const AliFlowTrackCuts& that):
   for(Int_t i(0); i < 180; i++) {
      fPurityFunction[i]=that.fPurityFunction[i];
   }
-  
-  fPhiCutLow = new TF1("fPhiCutLow",  "0.1/x/x+pi/18.0-0.025", 0, 100);
-  fPhiCutHigh = new TF1("fPhiCutHigh", "0.12/x+pi/18.0+0.035", 0, 100);
 }
 
 //-----------------------------------------------------------------------
@@ -619,13 +613,13 @@ AliFlowTrackCuts& AliFlowTrackCuts::operator=(const AliFlowTrackCuts& that)
   fCutTPCSecbound=that.fCutTPCSecbound;
   fCutTPCSecboundMinpt=that.fCutTPCSecboundMinpt;
   fCutTPCSecboundVar=that.fCutTPCSecboundVar;
-  fPhiCutLow=NULL;
-  fPhiCutHigh=NULL;
   fPtTOFPIDoff=that.fPtTOFPIDoff;
   fLinearizeVZEROresponse=that.fLinearizeVZEROresponse;
   fCentralityPercentileMin=that.fCentralityPercentileMin;
   fCentralityPercentileMax=that.fCentralityPercentileMax;
   fPurityLevel=that.fPurityLevel;
+  fPurityMap.clear(); // rebuilt at first use from the purity functions
+  fPurityMapTolerance.clear();
   fCutPmdDet=that.fCutPmdDet;
   fPmdDet=that.fPmdDet;
   fCutPmdAdc=that.fCutPmdAdc;
@@ -702,9 +696,6 @@ AliFlowTrackCuts& AliFlowTrackCuts::operator=(const AliFlowTrackCuts& that)
  
   fRun = that.fRun;
   
-  fPhiCutLow = new TF1("fPhiCutLow",  "0.1/x/x+pi/18.0-0.025", 0, 100);
-  fPhiCutHigh = new TF1("fPhiCutHigh", "0.12/x+pi/18.0+0.035", 0, 100);
-  
   return *this;
 }
 
@@ -751,8 +742,6 @@ AliFlowTrackCuts::~AliFlowTrackCuts()
         fPurityFunction[i] = 0;
     }
   }
-  if(fPhiCutLow) delete fPhiCutLow;
-  if(fPhiCutHigh) delete fPhiCutHigh;
 }
 
 //-----------------------------------------------------------------------
@@ -1516,7 +1505,7 @@ Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFi
     
     phimod += TMath::Pi()/18.0; // to center gap in the middle
     phimod = fmod(phimod, TMath::Pi()/9.0);
-    if(phimod < fPhiCutHigh->Eval(track->Pt()) && phimod > fPhiCutLow->Eval(track->Pt()))
+    if(phimod < GetPhiCutHigh(track->Pt()) && phimod > GetPhiCutLow(track->Pt()))
       pass=kFALSE; // reject track
   }
 
@@ -3986,12 +3975,7 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaPurityCut(const AliAODTrack* track)
     if(!fPIDResponse) return kFALSE;
     if(!track) return kFALSE;
     
-    Int_t p_int = -999;
-    Double_t pInterval=0;
-    for(int i=0;i<60;i++){
-        pInterval=0.1*i;
-        if(track->P()>pInterval && track->P()<pInterval+0.1){p_int = i;}
-    }
+    Int_t p_int = GetPurityMomentumBin(track->P());
     /*
      Double_t LowPtPIDTPCnsigLow_Pion[2] = {-3,-3};
      Double_t LowPtPIDTPCnsigLow_Kaon[2] = {-3,-2};
@@ -4009,8 +3993,9 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaPurityCut(const AliAODTrack* track)
         if(!fPurityFunction[index]){ cout<<"fPurityFunction[index] does not exist"<<endl; return kFALSE;}
         if(p_int>1){
             if((track->IsOn(AliAODTrack::kTOFpid))){
-                if(fPurityFunction[index]->Eval(nsigmaTOF,nsigmaTPC)>fPurityLevel){
-                    if(TMath::Sqrt(TMath::Power(nsigmaTPC,2)+TMath::Power(nsigmaTOF,2))<3){
+                // the nsigma cut first: the purity maps only cover the nsigma < 3 region
+                if(TMath::Sqrt(TMath::Power(nsigmaTPC,2)+TMath::Power(nsigmaTOF,2))<3){
+                    if(PassesPurityLevel(index,nsigmaTOF,nsigmaTPC)){
                         return kTRUE;
                     }
                 }
@@ -4025,6 +4010,85 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaPurityCut(const AliAODTrack* track)
     return kFALSE;
 }
 //-----------------------------------------------------------------------
+Int_t AliFlowTrackCuts::GetPurityMomentumBin(Double_t p) const
+{
+    // momentum bin of the purity functions, p in ]0.1*i,0.1*i+0.1[, -999 if none
+    // same result as testing all 60 intervals: the candidate bins around p*10
+    // are tested with the same comparisons, the highest matching one is kept
+    if(!(p>0. && p<6.1)) return -999;
+    Int_t ibin = (Int_t)(p*10.);
+    for(Int_t i=TMath::Min(ibin+1,59);i>=ibin-1 && i>=0;i--){
+        Double_t pInterval=0.1*i;
+        if(p>pInterval && p<pInterval+0.1) return i;
+    }
+    return -999;
+}
+//-----------------------------------------------------------------------
+void AliFlowTrackCuts::BuildPurityMaps()
+{
+    // tabulate the purity functions on a grid in (nsigmaTOF,nsigmaTPC) over
+    // [-3,3]x[-3,3], the region selected by the nsigma < 3 cut. For each
+    // function the largest deviation of the bilinear interpolation from the
+    // function, at the centres and edge midpoints of the cells, is stored as
+    // tolerance of the map (doubled for safety)
+    const Int_t nNodes = fgkPurityMapNodes*fgkPurityMapNodes;
+    fPurityMap.assign(180*nNodes,0.);
+    fPurityMapTolerance.assign(180,-1.);
+    for(Int_t i=0;i<180;i++){
+        if(!fPurityFunction[i]) continue;
+        Float_t *map = &fPurityMap[i*nNodes];
+        for(Int_t itof=0;itof<fgkPurityMapNodes;itof++){
+            for(Int_t itpc=0;itpc<fgkPurityMapNodes;itpc++){
+                map[itof*fgkPurityMapNodes+itpc] = fPurityFunction[i]->Eval(-fgkPurityMapRange+itof*fgkPurityMapStep,-fgkPurityMapRange+itpc*fgkPurityMapStep);
+            }
+        }
+        Double_t maxDeviation = 0.;
+        for(Int_t itof=0;itof<fgkPurityMapNodes-1;itof++){
+            for(Int_t itpc=0;itpc<fgkPurityMapNodes-1;itpc++){
+                Double_t tof = -fgkPurityMapRange+itof*fgkPurityMapStep;
+                Double_t tpc = -fgkPurityMapRange+itpc*fgkPurityMapStep;
+                const Double_t points[3][2] = {{tof+0.5*fgkPurityMapStep,tpc+0.5*fgkPurityMapStep},
+                                               {tof+0.5*fgkPurityMapStep,tpc},
+                                               {tof,tpc+0.5*fgkPurityMapStep}};
+                for(Int_t ipoint=0;ipoint<3;ipoint++){
+                    Double_t deviation = TMath::Abs(GetPurityFromMap(i,points[ipoint][0],points[ipoint][1])-fPurityFunction[i]->Eval(points[ipoint][0],points[ipoint][1]));
+                    if(deviation>maxDeviation) maxDeviation = deviation;
+                }
+            }
+        }
+        // float storage of the nodes
+        fPurityMapTolerance[i] = 2.*maxDeviation + 1.e-6;
+    }
+}
+//-----------------------------------------------------------------------
+Double_t AliFlowTrackCuts::GetPurityFromMap(Int_t index, Double_t nsigmaTOF, Double_t nsigmaTPC) const
+{
+    // bilinear interpolation of the tabulated purity function, the point must be inside the map
+    Double_t xtof = (nsigmaTOF+fgkPurityMapRange)/fgkPurityMapStep;
+    Double_t xtpc = (nsigmaTPC+fgkPurityMapRange)/fgkPurityMapStep;
+    Int_t itof = TMath::Min((Int_t)xtof,fgkPurityMapNodes-2);
+    Int_t itpc = TMath::Min((Int_t)xtpc,fgkPurityMapNodes-2);
+    Double_t ftof = xtof-itof;
+    Double_t ftpc = xtpc-itpc;
+    const Float_t *node = &fPurityMap[index*fgkPurityMapNodes*fgkPurityMapNodes + itof*fgkPurityMapNodes + itpc];
+    return (1.-ftof)*((1.-ftpc)*node[0]+ftpc*node[1]) + ftof*((1.-ftpc)*node[fgkPurityMapNodes]+ftpc*node[fgkPurityMapNodes+1]);
+}
+//-----------------------------------------------------------------------
+Bool_t AliFlowTrackCuts::PassesPurityLevel(Int_t index, Float_t nsigmaTOF, Float_t nsigmaTPC)
+{
+    // purity of the track above fPurityLevel, from the purity map; the purity
+    // function itself is evaluated only when the interpolated purity is within
+    // the tolerance of the map from the purity level, or outside the map
+    if(fPurityMap.empty()) BuildPurityMaps();
+    Double_t tolerance = fPurityMapTolerance[index];
+    if(tolerance<0. || TMath::Abs(nsigmaTOF)>fgkPurityMapRange || TMath::Abs(nsigmaTPC)>fgkPurityMapRange)
+        return fPurityFunction[index]->Eval(nsigmaTOF,nsigmaTPC)>fPurityLevel;
+    Double_t purity = GetPurityFromMap(index,nsigmaTOF,nsigmaTPC);
+    if(purity-tolerance>fPurityLevel) return kTRUE;
+    if(purity+tolerance<=fPurityLevel) return kFALSE;
+    return fPurityFunction[index]->Eval(nsigmaTOF,nsigmaTPC)>fPurityLevel;
+}
+//-----------------------------------------------------------------------
 void AliFlowTrackCuts::SetPriors(Float_t centrCur){
  //set priors for the bayesian pid selection
   fCurrCentr = centrCur;
@@ -5516,6 +5580,7 @@ void AliFlowTrackCuts::SetTPCTOFNsigmaPIDPurityFunctions(Float_t PurityLevel)
         fPurityFunction[i] = (TF2*)Species_functions[ispecie]->FindObject(Form("PurityFunction_%d%d",iPbin,iPbin+1));
         if(!fPurityFunction[i]){printf("Purity function does not exist"); return;}
     }
+    BuildPurityMaps();
 }
 //__________________
 Int_t AliFlowTrackCuts::MaxSharedITSClusterCuts(AliESDtrack* track){
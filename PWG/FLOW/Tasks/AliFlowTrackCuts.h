@@ -21,6 +21,8 @@
 #include "AliPID.h"
 #include "AliESDpid.h"
 #include "TF2.h"
+#include "TMath.h"
+#include <vector>
 
 
 class TBrowser;
@@ -373,6 +375,13 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   Bool_t PassesTPCTOFNsigmaCut(const AliAODTrack* track); 
   Bool_t PassesTPCTOFNsigmaCut(const AliESDtrack* track);
   Bool_t PassesTPCTOFNsigmaPurityCut(const AliAODTrack* track);
+  Int_t GetPurityMomentumBin(Double_t p) const;
+  void BuildPurityMaps();
+  Double_t GetPurityFromMap(Int_t index, Double_t nsigmaTOF, Double_t nsigmaTPC) const;
+  Bool_t PassesPurityLevel(Int_t index, Float_t nsigmaTOF, Float_t nsigmaTPC);
+  // TPC sector boundary cut, phi window vs pt
+  static Double_t GetPhiCutLow(Double_t pt) {return 0.1/pt/pt+TMath::Pi()/18.0-0.025;}
+  static Double_t GetPhiCutHigh(Double_t pt) {return 0.12/pt+TMath::Pi()/18.0+0.035;}
   Bool_t TPCTOFagree(const AliVTrack *track);
   // end part added by F. Noferini
   Bool_t PassesTPCTPCTOFNsigmaCut(const AliAODTrack* track); // added by B. Hohlweger
@@ -435,8 +444,6 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   Bool_t fCutTPCSecbound;         // cut tracks entering TPC close to TPC sector boundaries
   Double_t fCutTPCSecboundMinpt;  // minimum pT for previous cut
   Bool_t fCutTPCSecboundVar;      // cut tracks entering TPC close to TPC sector boundaries
-  TF1* fPhiCutLow; //!
-  TF1* fPhiCutHigh; //!
   Bool_t fLinearizeVZEROresponse; //linearize VZERO response using AliESDUtil
  
   Int_t fCentralityPercentileMin; //centrality min
@@ -520,6 +527,11 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   TDirectory            *fPurityFunctionsList;     //! purity functions list
     
   TF2                   *fPurityFunction[180]; //TF2 purity functions
+  static const Int_t    fgkPurityMapNodes = 61;    // nodes per nsigma axis of the purity maps
+  static const Double_t fgkPurityMapRange;         // purity maps cover [-range,range] in both nsigma
+  static const Double_t fgkPurityMapStep;          // node spacing of the purity maps
+  std::vector<Float_t>  fPurityMap;                //! purity functions tabulated on the nsigma grid
+  std::vector<Float_t>  fPurityMapTolerance;       //! max deviation of each purity map from its function
   
   Bool_t fCutITSclusterShared;          // cut fMaxITSClusterShared
   Int_t  fMaxITSclusterShared;          // fMaxITSclusterShared 
@@ -0,0 +1,71 @@
+// Array of AliBasicParticle stored in one contiguous block
+//
+// Used for the reduced track lists kept in the event mixing pools: instead of
+// one heap allocation per particle, all particles of an event are allocated
+// at once (the capacity is given in the constructor) and the array slots point
+// into this block. The array is not owner of its slots, the block is deleted
+// in the destructor. An array read from file or cloned holds individually
+// allocated particles, which are then deleted one by one.
+
+#include "AliBasicParticleArray.h"
+#include "AliBasicParticle.h"
+#include "AliLog.h"
+
+ClassImp(AliBasicParticleArray)
+
+//________________________________________________________________________
+AliBasicParticleArray::AliBasicParticleArray() :
+  TObjArray(),
+  fCapacity(0),
+  fBlock(0)
+{
+  // default constructor, used for I/O
+}
+
+//________________________________________________________________________
+AliBasicParticleArray::AliBasicParticleArray(Int_t capacity) :
+  TObjArray(capacity > 0 ? capacity : TCollection::kInitCapacity),
+  fCapacity(capacity > 0 ? capacity : 0),
+  fBlock(0)
+{
+  // constructor, allocates the particles
+  
+  if (fCapacity > 0)
+    fBlock = new AliBasicParticle[fCapacity];
+}
+
+//________________________________________________________________________
+AliBasicParticleArray::~AliBasicParticleArray()
+{
+  // destructor
+  
+  if (fBlock)
+  {
+    // the slots point into the block
+    SetOwner(kFALSE);
+    Clear();
+    delete[] fBlock;
+    fBlock = 0;
+  }
+  else
+    Delete();
+}
+
+//________________________________________________________________________
+AliBasicParticle* AliBasicParticleArray::AddParticle(Float_t eta, Float_t phi, Float_t pt, Short_t charge)
+{
+  // adds a particle at the end of the array, using the next free particle of the block
+  
+  Int_t n = GetEntriesFast();
+  if (!fBlock || n >= fCapacity)
+  {
+    AliFatal(Form("Capacity %d exceeded", fCapacity));
+    return 0;
+  }
+  
+  AliBasicParticle* particle = fBlock + n;
+  *particle = AliBasicParticle(eta, phi, pt, charge);
+  AddLast(particle);
+  
+  return particle;
+}
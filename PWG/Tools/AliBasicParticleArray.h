@@ -0,0 +1,34 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+// Array of AliBasicParticle stored in one contiguous block
+//
+#ifndef ALIBASICPARTICLEARRAY_H
+#define ALIBASICPARTICLEARRAY_H
+
+#include "TObjArray.h"
+
+class AliBasicParticle;
+
+class AliBasicParticleArray : public TObjArray
+{
+  public:
+    AliBasicParticleArray();
+    AliBasicParticleArray(Int_t capacity);
+    virtual ~AliBasicParticleArray();
+
+    AliBasicParticle* AddParticle(Float_t eta, Float_t phi, Float_t pt, Short_t charge);
+
+    Int_t GetCapacity() const { return fCapacity; }
+
+  private:
+    AliBasicParticleArray(const AliBasicParticleArray&);            // not implemented
+    AliBasicParticleArray& operator=(const AliBasicParticleArray&); // not implemented
+
+    Int_t fCapacity;            //! number of particles in fBlock
+    AliBasicParticle* fBlock;   //! particles of this array, one allocation
+
+    ClassDef(AliBasicParticleArray, 1); // array of AliBasicParticle with a single allocation, used for event mixing
+};
+
+#endif
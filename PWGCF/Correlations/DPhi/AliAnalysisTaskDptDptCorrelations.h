@@ -9,6 +9,7 @@
 #include "AliPIDResponse.h"
 
 class AliAODEvent;
+class AliDptDptBinnedPairs;
 class AliESDEvent;
 class AliInputEventHandler;
 class TH1;
@@ -93,6 +94,7 @@ public:
   
   virtual     void    SetRejectPileup(int v)              { _rejectPileup         = v; } 
   virtual     void    SetRejectPairConversion(int v)      { _rejectPairConversion = v; } 
+  virtual     void    SetBinnedPairs(int v)               { _binnedPairs          = v; }
   virtual     void    SetVertexZMin(double v)             { _vertexZMin           = v; } 
   virtual     void    SetVertexZMax(double v)             { _vertexZMax           = v; } 
   virtual     void    SetVertexXYMin(double v)            { _vertexXYMin          = v; } 
@@ -154,6 +156,7 @@ protected:
   int      _sameFilter;
   int      _rejectPileup; 
   int      _rejectPairConversion; 
+  int      _binnedPairs;
   double   _vertexZMin; 
   double   _vertexZMax; 
   double   _vertexXYMin; 
@@ -298,6 +301,8 @@ protected:
   float  * __s2PtN_12_vsEtaPhi;   //!
   float  * __s2NPt_12_vsEtaPhi;   //!
   
+  AliDptDptBinnedPairs * _pairEngine; //! binned pair accumulation, if requested
+  
   TH3F * _weight_1;
   TH3F * _weight_2;
   TH1D * _eventAccounting;
@@ -468,7 +473,7 @@ protected:
   TString vsPtVsPt;
 
   
-  ClassDef(AliAnalysisTaskDptDptCorrelations,1)
+  ClassDef(AliAnalysisTaskDptDptCorrelations,2)
 }; 
 
 
@@ -9,6 +9,7 @@
 #include "AliPIDResponse.h"
 
 class AliAODEvent;
+class AliDptDptBinnedPairs;
 class AliESDEvent;
 class AliInputEventHandler;
 class TH1;
@@ -109,6 +110,7 @@ public:
     
     virtual     void    SetRejectPileup(int v)              { _rejectPileup         = v; }
     virtual     void    SetRejectPairConversion(int v)      { _rejectPairConversion = v; }
+    virtual     void    SetBinnedPairs(int v)               { _binnedPairs          = v; }
     virtual     void    SetVertexZMin(double v)             { _vertexZMin           = v; }
     virtual     void    SetVertexZMax(double v)             { _vertexZMax           = v; }
     virtual     void    SetVertexZWidth(double v)           { _vertexZWidth         = v; }
@@ -192,6 +194,7 @@ protected:
     int      _sameFilter;
     int      _rejectPileup;
     int      _rejectPairConversion;
+    int      _binnedPairs;
     double   _vertexZMin;
     double   _vertexZMax;
     double   _vertexZWidth;
@@ -342,6 +345,8 @@ protected:
     float  * __s2PtN_12_vsEtaPhi;   //!
     float  * __s2NPt_12_vsEtaPhi;   //!
     
+    AliDptDptBinnedPairs * _pairEngine; //! binned pair accumulation, if requested
+    
     TH3F * _weight_1;
     TH3F * _weight_2;
     TH1D * _eventAccounting;
@@ -560,7 +565,7 @@ protected:
     TString vsPtVsPt;
     
     
-    ClassDef(AliAnalysisTaskPIDBFDptDpt,1)
+    ClassDef(AliAnalysisTaskPIDBFDptDpt,2)
 }; 
 
 
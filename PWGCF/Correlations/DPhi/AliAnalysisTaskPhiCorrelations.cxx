@@ -56,6 +56,7 @@
 
 #include "AliEventPoolManager.h"
 #include "AliBasicParticle.h"
+#include "AliBasicParticleArray.h"
 
 #include "AliESDZDC.h"
 #include "AliESDtrackCuts.h"
@@ -1581,30 +1582,39 @@ TObjArray* AliAnalysisTaskPhiCorrelations::CloneAndReduceTrackList(TObjArray* tr
 {
   // clones a track list by using AliBasicParticle which uses much less memory (used for event mixing)
   // Clone only a certain pt bin on demand
+  // The particles of the clone are allocated in one block (AliBasicParticleArray)
 
-  // Check if we already have a reduced track list. In that case a simple Clone is enough
-  // Only possible for inclusive pt
-  if(maxPt-minPt < 0)
-    if (tracks->GetEntriesFast() == 0 || tracks->UncheckedAt(0)->InheritsFrom("AliBasicParticle"))
-      return (TObjArray*) tracks->Clone();
-  
-  TObjArray* tracksClone = new TObjArray;
-  tracksClone->SetOwner(kTRUE);
+  Bool_t selectPt = (maxPt-minPt > 0);
+
+  // Count the particles first to allocate them at once
+  Int_t nSelected = 0;
+  for (Int_t i=0; i<tracks->GetEntriesFast(); i++)
+  {
+    AliVParticle* particle = (AliVParticle*) tracks->UncheckedAt(i);
+    if ( selectPt && ((particle->Pt()<minPt) || (particle->Pt()>=maxPt)) )
+      continue;
+    nSelected++;
+  }
+
+  // Check if we already have a reduced track list. In that case eta is copied as is
+  // (it already contains the rapidity if fFillCorrelationsRapidity is set)
+  Bool_t reduced = (tracks->GetEntriesFast() > 0 && tracks->UncheckedAt(0)->InheritsFrom("AliBasicParticle"));
+
+  AliBasicParticleArray* tracksClone = new AliBasicParticleArray(nSelected);
 
   for (Int_t i=0; i<tracks->GetEntriesFast(); i++)
   {
     AliVParticle* particle = (AliVParticle*) tracks->UncheckedAt(i);
     AliBasicParticle* copy = 0;
 
-    if ( (maxPt-minPt > 0) && ((particle->Pt()<minPt) || (particle->Pt()>=maxPt)) )
+    if ( selectPt && ((particle->Pt()<minPt) || (particle->Pt()>=maxPt)) )
       continue;
 
-    if (fFillCorrelationsRapidity)
-      copy = new AliBasicParticle(particle->Y(), particle->Phi(), particle->Pt(), particle->Charge());
+    if (fFillCorrelationsRapidity && !reduced)
+      copy = tracksClone->AddParticle(particle->Y(), particle->Phi(), particle->Pt(), particle->Charge());
     else
-      copy = new AliBasicParticle(particle->Eta(), particle->Phi(), particle->Pt(), particle->Charge());
+      copy = tracksClone->AddParticle(particle->Eta(), particle->Phi(), particle->Pt(), particle->Charge());
     copy->SetUniqueID(particle->GetUniqueID());
-    tracksClone->Add(copy);
   }
   
   return tracksClone;
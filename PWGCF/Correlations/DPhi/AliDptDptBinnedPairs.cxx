@@ -0,0 +1,297 @@
+/*
+Binned pair accumulation for the DptDpt tasks.
+See AliDptDptBinnedPairs.h
+*/
+//================================
+#include <algorithm>
+
+#include "AliLog.h"
+#include "AliDptDptBinnedPairs.h"
+
+using std::vector;
+
+ClassImp(AliDptDptBinnedPairs)
+
+namespace {
+  // order the self pairs by the bin of one of their particles
+  struct BinOrder
+  {
+    BinOrder(const int * bin, const vector<int> & item) : _bin(bin), _item(item) {}
+    bool operator()(int a, int b) const { return _bin[_item[a]] < _bin[_item[b]]; }
+    const int * _bin;
+    const vector<int> & _item;
+  };
+  // order the entries of a list by track id
+  struct IdOrder
+  {
+    IdOrder(const int * id) : _id(id) {}
+    bool operator()(int a, int b) const { return _id[a] < _id[b]; }
+    const int * _id;
+  };
+}
+
+AliDptDptBinnedPairs::AliDptDptBinnedPairs()
+: TObject(),
+_nBins_etaPhi_1(0),
+_nBins_pt_1(0),
+_nBins_etaPhi_2(0),
+_nBins_pt_2(0),
+_n2_12_vsEtaPhi(0),
+_s2ptpt_12_vsEtaPhi(0),
+_s2PtN_12_vsEtaPhi(0),
+_s2NPt_12_vsEtaPhi(0),
+_n2_12_vsPtPt(0),
+_n1_1_vsEtaPhi(),
+_s1pt_1_vsEtaPhi(),
+_n1_1_vsPt(),
+_n1_2_vsEtaPhi(),
+_s1pt_2_vsEtaPhi(),
+_n1_2_vsPt(),
+_used_etaPhi_1(),
+_used_pt_1(),
+_used_etaPhi_2(),
+_used_pt_2(),
+_self_1(),
+_self_2(),
+_order(),
+_hitEtaPhi(),
+_hitPt(),
+_selfRow_n2(),
+_selfRow_s2ptpt(),
+_selfRow_s2PtN(),
+_selfRow_s2NPt(),
+_n2_12(0),
+_s2ptpt_12(0),
+_s2PtN_12(0),
+_s2NPt_12(0),
+_n2Nw_12(0),
+_s2ptptNw_12(0),
+_s2PtNNw_12(0),
+_s2NPtNw_12(0)
+{
+}
+
+AliDptDptBinnedPairs::~AliDptDptBinnedPairs()
+{
+}
+
+// Set the binning and the pair arrays to fill. The eta-phi pair index is
+// iEtaPhi_1*nBins_etaPhi_1 + iEtaPhi_2 and the pt-pt index iPt_1*nBins_pt_2 + iPt_2,
+// as in the pair loops of the tasks.
+void AliDptDptBinnedPairs::initialize(int nBins_etaPhi_1, int nBins_pt_1, int nBins_etaPhi_2, int nBins_pt_2,
+                                      float * n2_12_vsEtaPhi, float * s2ptpt_12_vsEtaPhi, float * s2PtN_12_vsEtaPhi, float * s2NPt_12_vsEtaPhi,
+                                      double * n2_12_vsPtPt)
+{
+  _nBins_etaPhi_1 = nBins_etaPhi_1;
+  _nBins_pt_1     = nBins_pt_1;
+  _nBins_etaPhi_2 = nBins_etaPhi_2;
+  _nBins_pt_2     = nBins_pt_2;
+
+  _n2_12_vsEtaPhi     = n2_12_vsEtaPhi;
+  _s2ptpt_12_vsEtaPhi = s2ptpt_12_vsEtaPhi;
+  _s2PtN_12_vsEtaPhi  = s2PtN_12_vsEtaPhi;
+  _s2NPt_12_vsEtaPhi  = s2NPt_12_vsEtaPhi;
+  _n2_12_vsPtPt       = n2_12_vsPtPt;
+
+  _n1_1_vsEtaPhi.assign(_nBins_etaPhi_1, 0.);
+  _s1pt_1_vsEtaPhi.assign(_nBins_etaPhi_1, 0.);
+  _n1_1_vsPt.assign(_nBins_pt_1, 0.);
+  _n1_2_vsEtaPhi.assign(_nBins_etaPhi_2, 0.);
+  _s1pt_2_vsEtaPhi.assign(_nBins_etaPhi_2, 0.);
+  _n1_2_vsPt.assign(_nBins_pt_2, 0.);
+
+  int nRow = std::max(_nBins_etaPhi_2, _nBins_pt_2);
+  _selfRow_n2.assign(nRow, 0.);
+  _selfRow_s2ptpt.assign(nRow, 0.);
+  _selfRow_s2PtN.assign(nRow, 0.);
+  _selfRow_s2NPt.assign(nRow, 0.);
+
+  _used_etaPhi_1.clear();
+  _used_pt_1.clear();
+  _used_etaPhi_2.clear();
+  _used_pt_2.clear();
+}
+
+// Per event single particle sums of one list. The bins filled in the previous
+// event are reset first, then the bins used in this event are recorded.
+void AliDptDptBinnedPairs::fillSingles(int k, const int * iEtaPhi, const int * iPt, const float * pt, const float * correction,
+                                       vector<double> & n1_vsEtaPhi, vector<double> & s1pt_vsEtaPhi, vector<double> & n1_vsPt,
+                                       vector<int> & usedEtaPhi, vector<int> & usedPt)
+{
+  for (unsigned int i=0; i<usedEtaPhi.size(); i++)
+    {
+      n1_vsEtaPhi[usedEtaPhi[i]]   = 0.;
+      s1pt_vsEtaPhi[usedEtaPhi[i]] = 0.;
+    }
+  for (unsigned int i=0; i<usedPt.size(); i++) n1_vsPt[usedPt[i]] = 0.;
+  usedEtaPhi.clear();
+  usedPt.clear();
+
+  _hitEtaPhi.assign(n1_vsEtaPhi.size(), 0);
+  _hitPt.assign(n1_vsPt.size(), 0);
+
+  for (int i=0; i<k; i++)
+    {
+      int    e    = iEtaPhi[i];
+      int    p    = iPt[i];
+      double corr = correction[i];
+      if (!_hitEtaPhi[e]) { _hitEtaPhi[e] = 1; usedEtaPhi.push_back(e); }
+      if (!_hitPt[p])     { _hitPt[p]     = 1; usedPt.push_back(p);     }
+      n1_vsEtaPhi[e]   += corr;
+      s1pt_vsEtaPhi[e] += corr*pt[i];
+      n1_vsPt[p]       += corr;
+    }
+
+  std::sort(usedEtaPhi.begin(), usedEtaPhi.end());
+  std::sort(usedPt.begin(), usedPt.end());
+}
+
+// Find the entries of both lists coming from the same track, these pairs
+// are excluded by the pair loops and must be removed from the products.
+void AliDptDptBinnedPairs::findSelfPairs(int k1, const int * id_1, int k2, const int * id_2)
+{
+  _self_1.clear();
+  _self_2.clear();
+  if (k1==0 || k2==0) return;
+
+  _order.resize(k2);
+  for (int i2=0; i2<k2; i2++) _order[i2] = i2;
+  std::sort(_order.begin(), _order.end(), IdOrder(id_2));
+
+  for (int i1=0; i1<k1; i1++)
+    {
+      // first entry of list 2 with id >= id_1[i1]
+      int lo = 0, hi = k2;
+      while (lo<hi)
+        {
+          int mid = (lo+hi)/2;
+          if (id_2[_order[mid]] < id_1[i1]) lo = mid+1; else hi = mid;
+        }
+      for (int j=lo; j<k2 && id_2[_order[j]]==id_1[i1]; j++)
+        {
+          _self_1.push_back(i1);
+          _self_2.push_back(_order[j]);
+        }
+    }
+}
+
+// Accumulate all pairs (i1,i2) with id_1[i1] != id_2[i2] of one event
+// in the pair arrays and set the per event pair sums.
+void AliDptDptBinnedPairs::fillPairs(int k1, const int * id_1, const int * iEtaPhi_1, const int * iPt_1, const float * pt_1, const float * correction_1,
+                                     int k2, const int * id_2, const int * iEtaPhi_2, const int * iPt_2, const float * pt_2, const float * correction_2)
+{
+  if (!_n2_12_vsEtaPhi)
+    {
+      AliError("AliDptDptBinnedPairs::fillPairs() not initialized");
+      return;
+    }
+
+  fillSingles(k1, iEtaPhi_1, iPt_1, pt_1, correction_1, _n1_1_vsEtaPhi, _s1pt_1_vsEtaPhi, _n1_1_vsPt, _used_etaPhi_1, _used_pt_1);
+  fillSingles(k2, iEtaPhi_2, iPt_2, pt_2, correction_2, _n1_2_vsEtaPhi, _s1pt_2_vsEtaPhi, _n1_2_vsPt, _used_etaPhi_2, _used_pt_2);
+  findSelfPairs(k1, id_1, k2, id_2);
+
+  int nSelf = _self_1.size();
+
+  // per event sums, products of the single particle sums minus the self pairs
+  double n1_1 = 0, s1pt_1 = 0, s1ptNw_1 = 0;
+  double n1_2 = 0, s1pt_2 = 0, s1ptNw_2 = 0;
+  for (int i1=0; i1<k1; i1++) { n1_1 += correction_1[i1]; s1pt_1 += correction_1[i1]*pt_1[i1]; s1ptNw_1 += pt_1[i1]; }
+  for (int i2=0; i2<k2; i2++) { n1_2 += correction_2[i2]; s1pt_2 += correction_2[i2]*pt_2[i2]; s1ptNw_2 += pt_2[i2]; }
+
+  _n2_12       = n1_1*n1_2;
+  _s2ptpt_12   = s1pt_1*s1pt_2;
+  _s2PtN_12    = s1pt_1*n1_2;
+  _s2NPt_12    = n1_1*s1pt_2;
+  _n2Nw_12     = double(k1)*double(k2) - nSelf;
+  _s2ptptNw_12 = s1ptNw_1*s1ptNw_2;
+  _s2PtNNw_12  = s1ptNw_1*k2;
+  _s2NPtNw_12  = k1*s1ptNw_2;
+
+  for (int s=0; s<nSelf; s++)
+    {
+      int    i1   = _self_1[s];
+      int    i2   = _self_2[s];
+      double corr = double(correction_1[i1])*correction_2[i2];
+      _n2_12       -= corr;
+      _s2ptpt_12   -= corr*pt_1[i1]*pt_2[i2];
+      _s2PtN_12    -= corr*pt_1[i1];
+      _s2NPt_12    -= corr*pt_2[i2];
+      _s2ptptNw_12 -= double(pt_1[i1])*pt_2[i2];
+      _s2PtNNw_12  -= pt_1[i1];
+      _s2NPtNw_12  -= pt_2[i2];
+    }
+
+  // eta-phi pair arrays: for each occupied bin of particle 1, the self pairs
+  // of that bin are summed in a row indexed by the bin of particle 2 and
+  // subtracted before adding to the (float) pair arrays
+  _order.resize(nSelf);
+  for (int s=0; s<nSelf; s++) _order[s] = s;
+  std::sort(_order.begin(), _order.end(), BinOrder(iEtaPhi_1, _self_1));
+
+  int iSelf = 0;
+  for (unsigned int u1=0; u1<_used_etaPhi_1.size(); u1++)
+    {
+      int    e1     = _used_etaPhi_1[u1];
+      double n1     = _n1_1_vsEtaPhi[e1];
+      double s1     = _s1pt_1_vsEtaPhi[e1];
+      int    first  = iSelf;
+      while (iSelf<nSelf && iEtaPhi_1[_self_1[_order[iSelf]]]==e1)
+        {
+          int    i1   = _self_1[_order[iSelf]];
+          int    i2   = _self_2[_order[iSelf]];
+          int    e2   = iEtaPhi_2[i2];
+          double corr = double(correction_1[i1])*correction_2[i2];
+          _selfRow_n2[e2]     += corr;
+          _selfRow_s2ptpt[e2] += corr*pt_1[i1]*pt_2[i2];
+          _selfRow_s2PtN[e2]  += corr*pt_1[i1];
+          _selfRow_s2NPt[e2]  += corr*pt_2[i2];
+          ++iSelf;
+        }
+
+      int row = e1*_nBins_etaPhi_1;
+      for (unsigned int u2=0; u2<_used_etaPhi_2.size(); u2++)
+        {
+          int    e2 = _used_etaPhi_2[u2];
+          double n2 = _n1_2_vsEtaPhi[e2];
+          double s2 = _s1pt_2_vsEtaPhi[e2];
+          int    ij = row + e2;
+          _n2_12_vsEtaPhi[ij]     += n1*n2 - _selfRow_n2[e2];
+          _s2ptpt_12_vsEtaPhi[ij] += s1*s2 - _selfRow_s2ptpt[e2];
+          _s2PtN_12_vsEtaPhi[ij]  += s1*n2 - _selfRow_s2PtN[e2];
+          _s2NPt_12_vsEtaPhi[ij]  += n1*s2 - _selfRow_s2NPt[e2];
+        }
+
+      for (int s=first; s<iSelf; s++)
+        {
+          int e2 = iEtaPhi_2[_self_2[_order[s]]];
+          _selfRow_n2[e2] = _selfRow_s2ptpt[e2] = _selfRow_s2PtN[e2] = _selfRow_s2NPt[e2] = 0.;
+        }
+    }
+
+  // pt-pt pair array, same procedure
+  std::sort(_order.begin(), _order.end(), BinOrder(iPt_1, _self_1));
+
+  iSelf = 0;
+  for (unsigned int u1=0; u1<_used_pt_1.size(); u1++)
+    {
+      int    p1    = _used_pt_1[u1];
+      double n1    = _n1_1_vsPt[p1];
+      int    first = iSelf;
+      while (iSelf<nSelf && iPt_1[_self_1[_order[iSelf]]]==p1)
+        {
+          int i1 = _self_1[_order[iSelf]];
+          int i2 = _self_2[_order[iSelf]];
+          _selfRow_n2[iPt_2[i2]] += double(correction_1[i1])*correction_2[i2];
+          ++iSelf;
+        }
+
+      int row = p1*_nBins_pt_2;
+      for (unsigned int u2=0; u2<_used_pt_2.size(); u2++)
+        {
+          int p2 = _used_pt_2[u2];
+          _n2_12_vsPtPt[row + p2] += n1*_n1_2_vsPt[p2] - _selfRow_n2[p2];
+        }
+
+      for (int s=first; s<iSelf; s++) _selfRow_n2[iPt_2[_self_2[_order[s]]]] = 0.;
+    }
+}
@@ -0,0 +1,102 @@
+#ifndef AliDptDptBinnedPairs_H_Included
+#define AliDptDptBinnedPairs_H_Included
+
+#include "TObject.h"
+#include <vector>
+
+/*
+Binned pair accumulation for the DptDpt tasks.
+
+The pair histogram arrays (n2, sumPtPt, sumPtN, sumNPt vs eta-phi bins of
+particle 1 and 2, and n2 vs pt-pt) are sums over all pairs (i1,i2) of
+particles of filter 1 and filter 2 of products of single particle terms.
+They are therefore obtained as outer products of the per event single
+particle sums (counts and sum of pt per eta-phi and per pt bin), looping
+only on the occupied bins. Pairs made of the same track in both lists
+(id_1 == id_2) are removed exactly. The cost per event is
+O(k1 + k2 + occupied bins 1 x occupied bins 2) instead of O(k1 x k2).
+
+Valid only when the two lists are different filters and no pair dependent
+selection (e.g. conversion rejection) is applied.
+*/
+
+class AliDptDptBinnedPairs : public TObject
+{
+public:
+  AliDptDptBinnedPairs();
+  virtual ~AliDptDptBinnedPairs();
+
+  void initialize(int nBins_etaPhi_1, int nBins_pt_1, int nBins_etaPhi_2, int nBins_pt_2,
+                  float * n2_12_vsEtaPhi, float * s2ptpt_12_vsEtaPhi, float * s2PtN_12_vsEtaPhi, float * s2NPt_12_vsEtaPhi,
+                  double * n2_12_vsPtPt);
+
+  void fillPairs(int k1, const int * id_1, const int * iEtaPhi_1, const int * iPt_1, const float * pt_1, const float * correction_1,
+                 int k2, const int * id_2, const int * iEtaPhi_2, const int * iPt_2, const float * pt_2, const float * correction_2);
+
+  double getN2()         const { return _n2_12;        }
+  double getS2PtPt()     const { return _s2ptpt_12;    }
+  double getS2PtN()      const { return _s2PtN_12;     }
+  double getS2NPt()      const { return _s2NPt_12;     }
+  double getN2Nw()       const { return _n2Nw_12;      }
+  double getS2PtPtNw()   const { return _s2ptptNw_12;  }
+  double getS2PtNNw()    const { return _s2PtNNw_12;   }
+  double getS2NPtNw()    const { return _s2NPtNw_12;   }
+
+private:
+  AliDptDptBinnedPairs(const  AliDptDptBinnedPairs&);
+  const AliDptDptBinnedPairs& operator=(const  AliDptDptBinnedPairs&);
+
+  void fillSingles(int k, const int * iEtaPhi, const int * iPt, const float * pt, const float * correction,
+                   std::vector<double> & n1_vsEtaPhi, std::vector<double> & s1pt_vsEtaPhi, std::vector<double> & n1_vsPt,
+                   std::vector<int> & usedEtaPhi, std::vector<int> & usedPt);
+  void findSelfPairs(int k1, const int * id_1, int k2, const int * id_2);
+
+  int _nBins_etaPhi_1;
+  int _nBins_pt_1;
+  int _nBins_etaPhi_2;
+  int _nBins_pt_2;
+
+  // pair arrays of the task, not owned
+  float  * _n2_12_vsEtaPhi;     //!
+  float  * _s2ptpt_12_vsEtaPhi; //!
+  float  * _s2PtN_12_vsEtaPhi;  //!
+  float  * _s2NPt_12_vsEtaPhi;  //!
+  double * _n2_12_vsPtPt;       //!
+
+  // per event single particle sums and list of occupied bins
+  std::vector<double> _n1_1_vsEtaPhi;    //!
+  std::vector<double> _s1pt_1_vsEtaPhi;  //!
+  std::vector<double> _n1_1_vsPt;        //!
+  std::vector<double> _n1_2_vsEtaPhi;    //!
+  std::vector<double> _s1pt_2_vsEtaPhi;  //!
+  std::vector<double> _n1_2_vsPt;        //!
+  std::vector<int>    _used_etaPhi_1;    //!
+  std::vector<int>    _used_pt_1;        //!
+  std::vector<int>    _used_etaPhi_2;    //!
+  std::vector<int>    _used_pt_2;        //!
+
+  // pairs of the same track in both lists, as (i1,i2), and work arrays
+  std::vector<int>    _self_1;           //!
+  std::vector<int>    _self_2;           //!
+  std::vector<int>    _order;            //!
+  std::vector<char>   _hitEtaPhi;        //!
+  std::vector<char>   _hitPt;            //!
+  std::vector<double> _selfRow_n2;       //!
+  std::vector<double> _selfRow_s2ptpt;   //!
+  std::vector<double> _selfRow_s2PtN;    //!
+  std::vector<double> _selfRow_s2NPt;    //!
+
+  // per event pair sums
+  double _n2_12;
+  double _s2ptpt_12;
+  double _s2PtN_12;
+  double _s2NPt_12;
+  double _n2Nw_12;
+  double _s2ptptNw_12;
+  double _s2PtNNw_12;
+  double _s2NPtNw_12;
+
+  ClassDef(AliDptDptBinnedPairs,1)
+};
+
+#endif
@@ -8,6 +8,7 @@
 #pragma link C++ class AliAnalysisTaskDptDptQA+;
 #pragma link C++ class AlianalysisTaskDptPIDpPb+;
 #pragma link C++ class AliDptDptInMC+;
+#pragma link C++ class AliDptDptBinnedPairs+;
 #pragma link C++ class AliAnalysisTaskpxpx+;
 #pragma link C++ class AliAnalysisTaskpxpy+;
 #pragma link C++ class AliAnalysisTaskpypy+;
@@ -25,7 +25,16 @@ AliJEfficiency::AliJEfficiency():
   fTag(""),
   fInputRootName(""),
   fInputRoot(NULL),
-  fCentBin(0x0)
+  fCentBin(0x0),
+  fTableKnot(),
+  fTableNKnots(),
+  fTableCell(),
+  fTableNCells(),
+  fTableXmin(),
+  fTableInvWidth(),
+  fTableX(),
+  fTableY(),
+  fTableSeg()
 {
   for (int i=0; i<3; i++) fEffDir[i] = NULL;
 }
@@ -43,7 +52,16 @@ AliJEfficiency::AliJEfficiency(const AliJEfficiency& obj) :
   fTag(obj.fTag),
   fInputRootName(obj.fInputRootName),
   fInputRoot(obj.fInputRoot),
-  fCentBin(obj.fCentBin)
+  fCentBin(obj.fCentBin),
+  fTableKnot(obj.fTableKnot),
+  fTableNKnots(obj.fTableNKnots),
+  fTableCell(obj.fTableCell),
+  fTableNCells(obj.fTableNCells),
+  fTableXmin(obj.fTableXmin),
+  fTableInvWidth(obj.fTableInvWidth),
+  fTableX(obj.fTableX),
+  fTableY(obj.fTableY),
+  fTableSeg(obj.fTableSeg)
 {
   // copy constructor TODO: handling of pointer members
   JUNUSED(obj);
@@ -156,6 +174,7 @@ bool AliJEfficiency::Load(){
 		  }
 	  }
   }
+  BuildTables();
   cout<<"J_LOG : Eff file is "<<fInputRootName<<endl;
   cout<<"J_LOG : Eff Cent Bins are ";
   for( int i=0;i<=nCentBin;i++ ){
@@ -165,24 +184,114 @@ bool AliJEfficiency::Load(){
   return true;
 }
 
-double AliJEfficiency::GetCorrection( double pt, int icut , double cent ) const {
-	// TODO : Function mode
-	if( fMode == kNotUse ) return 1;
+void AliJEfficiency::BuildTables(){
+	// Tabulate the correction graphs for a lookup without point search.
+	// Graphs with less than 2 points or not strictly increasing in pt are left to TGraph::Eval
+	const int nCellsPerKnot = 4;
+	int nCentBin = fCentBin->GetNbins();
+	int nCut = fTrackCut.GetNCut();
+	int nTable = nCentBin*nCut;
+	fTableKnot.assign( nTable, -1 );
+	fTableNKnots.assign( nTable, 0 );
+	fTableCell.assign( nTable, 0 );
+	fTableNCells.assign( nTable, 0 );
+	fTableXmin.assign( nTable, 0 );
+	fTableInvWidth.assign( nTable, 0 );
+	fTableX.clear();
+	fTableY.clear();
+	fTableSeg.clear();
+	int ivtx = 0;
+	for( int icent=0;icent<nCentBin;icent++ ){
+		for( int icut=0;icut<nCut;icut++ ){
+			TGraphErrors * gr = fCorrection[ivtx][icent][icut];
+			if( !gr ) continue;
+			int n = gr->GetN();
+			if( n < 2 ) continue;
+			const double * x = gr->GetX();
+			const double * y = gr->GetY();
+			bool sorted = true;
+			for( int i=1;i<n;i++ ) if( !(x[i] > x[i-1]) ) { sorted = false; break; }
+			if( !sorted ) {
+				cout<<"J_WARNING : Eff graph "<<icent<<" "<<icut<<" is not sorted in pt, TGraph::Eval is used"<<endl;
+				continue;
+			}
+			int itable = icent*nCut+icut;
+			fTableKnot[itable] = fTableX.size();
+			fTableNKnots[itable] = n;
+			fTableX.insert( fTableX.end(), x, x+n );
+			fTableY.insert( fTableY.end(), y, y+n );
+
+			int nCells = nCellsPerKnot*(n-1);
+			double width = (x[n-1]-x[0])/nCells;
+			fTableCell[itable] = fTableSeg.size();
+			fTableNCells[itable] = nCells;
+			fTableXmin[itable] = x[0];
+			fTableInvWidth[itable] = 1./width;
+			int iseg = 0;
+			for( int icell=0;icell<nCells;icell++ ){
+				double edge = x[0] + icell*width;
+				while( iseg < n-2 && x[iseg+1] <= edge ) iseg++;
+				fTableSeg.push_back( iseg );
+			}
+		}
+	}
+}
+
+double AliJEfficiency::EvalTable( int itable, double pt ) const {
+	// Same as TGraph::Eval(pt) (linear interpolation, linear extrapolation outside the graph)
+	// for a graph strictly increasing in pt : same segment and same formula, so the same value
+	const double * x = &fTableX[fTableKnot[itable]];
+	const double * y = &fTableY[fTableKnot[itable]];
+	int n = fTableNKnots[itable];
+	int nCells = fTableNCells[itable];
+	int low = 0;
+	if( pt > x[0] ) {
+		int icell = int( (pt - fTableXmin[itable]) * fTableInvWidth[itable] );
+		if( icell > nCells-1 ) icell = nCells-1;
+		low = fTableSeg[fTableCell[itable]+icell];
+		// the cell search may be off by one cell because of rounding
+		while( low > 0 && x[low] > pt ) low--;
+		while( low < n-2 && x[low+1] <= pt ) low++;
+	}
+	int up = low+1;
+	if( pt == x[low] ) return y[low];
+	if( pt == x[up] ) return y[up];
+	return y[up] + (pt - x[up]) * (y[low] - y[up]) / (x[low] - x[up]);
+}
+
+int AliJEfficiency::GetCentralityBin( double cent ) const {
+	// centrality bin of the correction, -1 if out of the bins. 0 if efficiency is not used
+	if( fMode == kNotUse ) return 0;
 	int icent = fCentBin->FindBin( cent ) -1 ;
 	if( icent < 0 || icent > fCentBin->GetNbins()-1 ) {
 		cout<<"J_WARNING : Centrality "<<cent<<" is out of CentBinBorder"<<endl;
-		return 1;
+		return -1;
 	}
-	// TODO error check for icent;
+	return icent;
+}
+
+double AliJEfficiency::GetCorrection( double pt, int icut , double cent ) const {
+	// TODO : Function mode
+	if( fMode == kNotUse ) return 1;
+	int icent = GetCentralityBin( cent );
+	if( icent < 0 ) return 1;
+	return GetCorrectionForCentBin( pt, icut, icent );
+}
+
+double AliJEfficiency::GetCorrectionForCentBin( double pt, int icut, int icent ) const {
+	// correction for the centrality bin from GetCentralityBin
+	if( fMode == kNotUse ) return 1;
+	if( icent < 0 ) return 1;
+	if( icent >= fCentBin->GetNbins() ) return 1;
 	int ivtx = 0;
 	if( ! fCorrection[ivtx][icent][icut] ) {
-		cout<<"J_WARNING : No Eff Info "<<pt<<"\t"<<icut<<"\t"<<cent<<"\t"<<icent<<endl;
+		cout<<"J_WARNING : No Eff Info "<<pt<<"\t"<<icut<<"\t"<<icent<<endl;
 		return 1;
 	}
-	TGraphErrors * gr = fCorrection[ivtx][icent][icut];
 	//=== TEMPERORY SETTING. IT will be removed soon.
 	if( pt > 30 ) pt = 30; // Getting eff of 30GeV for lager pt
-	double cor = gr->Eval(pt);
+	int itable = icent*fTrackCut.GetNCut()+icut;
+	double cor = ( itable < int(fTableKnot.size()) && fTableKnot[itable] >= 0 ) ? EvalTable( itable, pt ) : fCorrection[ivtx][icent][icut]->Eval(pt);
 	if ( cor < 0.2 ) cor = 0.2;
 	return cor;
 }
@@ -12,6 +12,7 @@
 #include <TGraphErrors.h>
 #include <TAxis.h>
 #include <iostream>
+#include <vector>
 using namespace std;
 
 class AliJEfficiency{
@@ -35,6 +36,9 @@ class AliJEfficiency{
 
         TString GetName() const { return fName; }
         double GetCorrection( double pt, int icut, double cent ) const ;
+        // Centrality handle : find the bin once per event and use it for all tracks
+        int    GetCentralityBin( double cent ) const ;
+        double GetCorrectionForCentBin( double pt, int icut, int icent ) const ;
         TString GetEffName() ;
         TString GetEffFullName() ;
         bool   Load();
@@ -44,6 +48,9 @@ class AliJEfficiency{
         void Write();
 
     private:
+        void   BuildTables();
+        double EvalTable( int itable, double pt ) const ;
+
         int      fMode;             // Mode. see enum Mode
         int      fPeriod;           // Data Period index
         AliJTrackCut fTrackCut;     // Track Cut Object. TODO:why not pointer?
@@ -61,5 +68,18 @@ class AliJEfficiency{
         TDirectory * fEffDir[3];    // root directory of efficiency. only second item of fEffDir with "Efficiency" is being used.
         TGraphErrors * fCorrection[20][20][20]; // Storage of Correction factor 
         TAxis * fCentBin;     // Bin of Centrality. replace with AliJBin?
+
+        // Tabulated correction graphs, one table per (cent, cut) : itable = icent*NCut+icut
+        // The knots of the graph are copied and a uniform pt grid gives the graph segment of each cell,
+        // so that the linear interpolation of TGraph::Eval is done without point search.
+        std::vector<int>    fTableKnot;     //! first knot of each table in fTableX/Y, -1 : no table, use TGraph::Eval
+        std::vector<int>    fTableNKnots;   //! number of knots of each table
+        std::vector<int>    fTableCell;     //! first cell of each table in fTableSeg
+        std::vector<int>    fTableNCells;   //! number of cells of each table
+        std::vector<double> fTableXmin;     //! lower edge of the grid of each table
+        std::vector<double> fTableInvWidth; //! inverse cell width of the grid of each table
+        std::vector<double> fTableX;        //! knots x
+        std::vector<double> fTableY;        //! knots y
+        std::vector<int>    fTableSeg;      //! segment (index of the lower knot) at the lower edge of each cell
 };
 #endif
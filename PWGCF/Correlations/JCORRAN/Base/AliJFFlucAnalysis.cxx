@@ -405,9 +405,13 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 				QnB_star[ih] = TComplex(0,0);			
 		}
 		//--------------- Calculate Qn--------------------
+		// all harmonics, both sub-events and (for the SC pt dependence) all pt bins in one track loop
+		TComplex QnSub[kNSub][kNH];
+		TComplex QnSub_pt[kNSub][kNH][N_ptbins];
+		CalculateQnSPAll( Eta_config, QnSub, IsSCptdep == kTRUE ? QnSub_pt : 0 );
 		for(int ih=0; ih<kNH; ih++){
-				QnA[ih] = CalculateQnSP( Eta_config[kSubA][kMin], Eta_config[kSubA][kMax], ih);
-				QnB[ih] = CalculateQnSP( Eta_config[kSubB][kMin], Eta_config[kSubB][kMax], ih);
+				QnA[ih] = QnSub[kSubA][ih];
+				QnB[ih] = QnSub[kSubB][ih];
 //				fh_Qvector[fCBin][0][ih]->Fill( QnA[ih].Theta() );
 //				fh_Qvector[fCBin][1][ih]->Fill( QnB[ih].Theta() );	
 				QnB_star[ih] = TComplex::Conjugate ( QnB[ih] ) ;
@@ -466,9 +470,10 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		if( IsEbEWeighted == kTRUE ) ebe_2p_weight = NSubTracks[kSubA] * NSubTracks[kSubB] ; 	
 		if( IsEbEWeighted == kTRUE ) ebe_4p_weight = NSubTracks[kSubA]* NSubTracks[kSubB] * (NSubTracks[kSubA]-1) * (NSubTracks[kSubB]-1) ; 
 
+		// flat index access, the indices are within the bins [kNH][nKL]([kNH][nKL])[fNCent] by construction
 		for(int ih=2; ih< kNH; ih++){
 				for(int ik=0; ik<nKL; ik++){
-						if(vn2[ih][ik] != -999)	fh_vn[ih][ik][fCBin]->Fill( vn2[ih][ik] , ebe_2p_weight ); // Fill hvn2
+						if(vn2[ih][ik] != -999)	fh_vn.At( fh_vn.GetFlatIndex(ih, ik, fCBin) )->Fill( vn2[ih][ik] , ebe_2p_weight ); // Fill hvn2
 				}
 		}
 
@@ -476,7 +481,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 				for( int ik=1; ik<nKL; ik++){
 						for( int ihh=2; ihh<kNH; ihh++){ 
 								for(int ikk=1; ikk<nKL; ikk++){
-										if(vn2_vn2[ih][ik][ihh][ikk] != -999 ) fh_vn_vn[ih][ik][ihh][ikk][fCBin]->Fill( vn2_vn2[ih][ik][ihh][ikk], ebe_4p_weight ) ; // Fill hvn_vn 
+										if(vn2_vn2[ih][ik][ihh][ikk] != -999 ) fh_vn_vn.At( fh_vn_vn.GetFlatIndex(ih, ik, ihh, ikk, fCBin) )->Fill( vn2_vn2[ih][ik][ihh][ikk], ebe_4p_weight ) ; // Fill hvn_vn 
 								}
 						}
 				}
@@ -540,32 +545,15 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 
 		if(IsSCptdep == kTRUE){
 				const int SCNH =6; // 0, 1, 2(v2), 3(v3), 4(v4), 5(v5)
-				Double_t ptbin_borders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
-				//init
-				TComplex QnA_pt[SCNH][N_ptbins];
-				TComplex QnB_pt[SCNH][N_ptbins];
-				TComplex QnB_pt_star[SCNH][N_ptbins];
-				for(int ih=2; ih<SCNH; ih++){
+				// Qn for each pt bins, already calculated with the integrated ones
+				// (harmonics up to kNH are needed by the self-correlation terms below)
+				TComplex QnA_pt[kNH][N_ptbins];
+				TComplex QnB_pt[kNH][N_ptbins];
+				TComplex QnB_pt_star[kNH][N_ptbins];
+				for(int ih=2; ih<kNH; ih++){
 						for(int ipt=0; ipt<N_ptbins; ipt++){
-								QnA_pt[ih][ipt] = TComplex(0,0);
-								QnB_pt[ih][ipt] = TComplex(0,0);
-								QnB_pt_star[ih][ipt] = TComplex(0,0);
-						}
-				}	
-
-				// calculate Qn for each pt bins	
-				for(int ih=2; ih<SCNH; ih++){
-						for(int ipt=0; ipt<N_ptbins; ipt++){
-								Double_t pt_bin_min = ptbin_borders[ipt];
-								Double_t pt_bin_max = ptbin_borders[ipt+1]; 
-								Double_t QAReal=Get_Qn_Real_pt( Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-								Double_t QAImag=Get_Qn_Img_pt(  Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-
-								Double_t QBReal=Get_Qn_Real_pt( Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-								Double_t QBImag=Get_Qn_Img_pt(  Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-
-								QnA_pt[ih][ipt]= TComplex(QAReal, QAImag);
-								QnB_pt[ih][ipt]= TComplex(QBReal, QBImag);
+								QnA_pt[ih][ipt]= QnSub_pt[kSubA][ih][ipt];
+								QnB_pt[ih][ipt]= QnSub_pt[kSubB][ih][ipt];
 								QnB_pt_star[ih][ipt] = TComplex::Conjugate( QnB_pt[ih][ipt] ) ; 
 						}
 				}		
@@ -700,11 +688,12 @@ void AliJFFlucAnalysis::Terminate(Option_t *)
 //________________________________________________________________________
 void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
 {
+		int effCentBin = fEfficiency->GetCentralityBin( fCent );
 		Long64_t ntracks = fInputList->GetEntriesFast();
 		for( Long64_t it=0; it< ntracks; it++){
 				AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
 				Double_t pt = itrack->Pt();
-				Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
+				Double_t effCorr = fEfficiency->GetCorrectionForCentBin( pt, fEffFilterBit, effCentBin );
 				Double_t eta = itrack->Eta();
 				int isub = -1;
 				if( eta < 0 ) isub = 0;
@@ -756,6 +745,103 @@ TComplex AliJFFlucAnalysis::CalculateQnSP( Double_t eta1, Double_t eta2, int har
 		if( ih !=0) Qn /= Sub_Ntrk; // Use Qn[0] as total number of tracks(*eff)
 		return Qn;
 }
+//________________________________________________________________________
+void AliJFFlucAnalysis::CalculateQnSPAll( Double_t etaConfig[][2], TComplex Qn[][kNH], TComplex Qn_pt[][kNH][N_ptbins] )
+{
+		// Same as CalculateQnSP( etaConfig[isub][0], etaConfig[isub][1], ih ) for the 2 sub-events and all harmonics
+		// and, if Qn_pt is given, as Get_Qn_Real_pt/Get_Qn_Img_pt for all the pt bins of the SC pt dependence,
+		// with the efficiency and phi modulation weights evaluated once per track.
+		// cos(n*phi), sin(n*phi) are obtained from the angle addition recurrence.
+		const int NSub = 2;
+		Double_t ptbin_borders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
+
+		Double_t QnRe[NSub][kNH], QnIm[NSub][kNH];
+		Double_t Sub_Ntrk[NSub];
+		Double_t QnRe_pt[NSub][kNH][N_ptbins], QnIm_pt[NSub][kNH][N_ptbins];
+		Double_t Sub_Ntrk_pt[NSub][N_ptbins];
+		for(int isub=0; isub<NSub; isub++){
+				Sub_Ntrk[isub] = 0;
+				for(int ih=0; ih<kNH; ih++){ QnRe[isub][ih] = 0; QnIm[isub][ih] = 0; }
+				for(int ipt=0; ipt<N_ptbins; ipt++){
+						Sub_Ntrk_pt[isub][ipt] = 0;
+						for(int ih=0; ih<kNH; ih++){ QnRe_pt[isub][ih][ipt] = 0; QnIm_pt[isub][ih][ipt] = 0; }
+				}
+		}
+
+		Double_t cosn[kNH], sinn[kNH];
+		int effCentBin = fEfficiency->GetCentralityBin( fCent );
+		Long64_t ntracks = fInputList->GetEntriesFast();
+		for(Long64_t it=0; it< ntracks; it++){
+				AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
+				Double_t pt = itrack->Pt();
+				Double_t eta = itrack->Eta();
+
+				// sub-events of the track, the eta range is inclusive for the integrated Qn, exclusive for the pt bins
+				Bool_t inSub[NSub], inSub_pt[NSub];
+				Bool_t used = kFALSE;
+				for(int isub=0; isub<NSub; isub++){
+						inSub[isub] = !( eta < etaConfig[isub][0] || eta > etaConfig[isub][1] );
+						inSub_pt[isub] = Qn_pt && eta > etaConfig[isub][0] && eta < etaConfig[isub][1];
+						if( inSub[isub] || inSub_pt[isub] ) used = kTRUE;
+				}
+				if( !used ) continue;
+
+				int ipt = -1;
+				for(int ib=0; ib<N_ptbins; ib++){
+						if( pt > ptbin_borders[ib] && pt < ptbin_borders[ib+1] ){ ipt = ib; break; }
+				}
+				if( ipt<0 && !inSub[0] && !inSub[1] ) continue;
+
+				Double_t phi = itrack->Phi();
+				Double_t phi_module_corr = 1;
+				int isub = -1;
+				if( eta < 0 ) isub = 0;
+				if( eta > 0 ) isub = 1;
+				if( IsPhiModule == kTRUE){ phi_module_corr = h_phi_module[fCBin][isub]->GetBinContent( (h_phi_module[fCBin][isub]->GetXaxis()->FindBin( phi ) )  );}
+				Double_t effCorr = fEfficiency->GetCorrectionForCentBin( pt, fEffFilterBit, effCentBin );
+				Double_t w = 1./effCorr * phi_module_corr;
+
+				cosn[0] = 1; sinn[0] = 0;
+				cosn[1] = TMath::Cos(phi); sinn[1] = TMath::Sin(phi);
+				for(int ih=2; ih<kNH; ih++){
+						cosn[ih] = cosn[ih-1]*cosn[1] - sinn[ih-1]*sinn[1];
+						sinn[ih] = sinn[ih-1]*cosn[1] + cosn[ih-1]*sinn[1];
+				}
+
+				for(int is=0; is<NSub; is++){
+						if( inSub[is] ){
+								for(int ih=0; ih<kNH; ih++){
+										QnRe[is][ih] += w * cosn[ih];
+										QnIm[is][ih] += w * sinn[ih];
+								}
+								Sub_Ntrk[is] += w;
+						}
+						if( inSub_pt[is] && ipt>=0 ){
+								for(int ih=0; ih<kNH; ih++){
+										QnRe_pt[is][ih][ipt] += w * cosn[ih];
+										QnIm_pt[is][ih][ipt] += w * sinn[ih];
+								}
+								Sub_Ntrk_pt[is][ipt] += w;
+						}
+				}
+		}
+
+		for(int is=0; is<NSub; is++){
+				for(int ih=0; ih<kNH; ih++){
+						Qn[is][ih] = TComplex( QnRe[is][ih], QnIm[is][ih] );
+						if( ih !=0) Qn[is][ih] /= Sub_Ntrk[is]; // Use Qn[0] as total number of tracks(*eff)
+				}
+				if( !Qn_pt ) continue;
+				int iside = 0; // eta - 
+				if( etaConfig[is][0] > 0 ) iside = 1; // eta +
+				for(int ipt=0; ipt<N_ptbins; ipt++){
+						for(int ih=0; ih<kNH; ih++){
+								Qn_pt[is][ih][ipt] = TComplex( QnRe_pt[is][ih][ipt] / Sub_Ntrk_pt[is][ipt], QnIm_pt[is][ih][ipt] / Sub_Ntrk_pt[is][ipt] );
+						}
+						NSubTracks_pt[iside][ipt] = Sub_Ntrk_pt[is][ipt];
+				}
+		}
+}
 ///________________________________________________________________________
 Double_t AliJFFlucAnalysis::Get_QC_Vn(Double_t QnA_real, Double_t QnA_img, Double_t QnB_real, Double_t QnB_img )
 {
@@ -872,14 +958,15 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(){
 				/////////////////////////////////////////////////
 
 				for(int ih=0; ih<kNH; ih++){
+						TComplex qn = TComplex( TMath::Cos(ih*phi), TMath::Sin(ih*phi) ); // same for all ik
 						for(int ik=0; ik<nKL; ik++){
-								QvectorQC[ih][ik] += TComplex( TMath::Cos(ih*phi), TMath::Sin(ih*phi) );
+								QvectorQC[ih][ik] += qn;
 								// this is not working (there are no eta gap for +0.6, +0.61 in this way..
 								// fix this as like SP -> 2 sub event // 
 								if( TMath::Abs(eta) > 0.5 ){  // this is for Noramlized SC ( denominator need eta gap )
 									int isub = 0;
 									if( eta > 0 ) isub = 1; // what about eta=0?
-									 QvectorQCeta10[ih][ik][isub] += TComplex( TMath::Cos(ih*phi), TMath::Sin(ih*phi) );
+									 QvectorQCeta10[ih][ik][isub] += qn;
 								}
 						}
 				}
@@ -149,6 +149,8 @@ class AliJFFlucAnalysis : public AliAnalysisTaskSE {
 		// addtinal variables for ptbins(Standard Candles only)
 		enum{kPt0, kPt1, kPt2, kPt3, kPt4, kPt5, kPt6, kPt7, N_ptbins};
 		double NSubTracks_pt[2][N_ptbins];
+		// Qn of the two SP sub-events for all harmonics (and pt bins if Qn_pt is given) in one pass over the tracks
+		void CalculateQnSPAll( Double_t etaConfig[][2], TComplex Qn[][kNH], TComplex Qn_pt[][kNH][N_ptbins] );
 		AliJBin fBin_Nptbins;//!
 		AliJTH1D fh_SC_ptdep_4corr;//! // for < vn^2 vm^2 >
 		AliJTH1D fh_SC_ptdep_2corr;//!  // for < vn^2 >
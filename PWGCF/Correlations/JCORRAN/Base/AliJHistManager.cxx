@@ -206,6 +206,7 @@ AliJArrayBase::AliJArrayBase():
     //AliJNamed("AliJArayBase","","&Dir=default&LessLazy",0),
     fDim(0),
     fIndex(0),
+    fStride(0),
     fArraySize(0),
     fNGenerated(0),
     fIsBinFixed(false),
@@ -225,6 +226,7 @@ AliJArrayBase::AliJArrayBase(const AliJArrayBase& obj) :
     AliJNamed(obj.fName,obj.fTitle,obj.fOption,obj.fMode),
     fDim(obj.fDim),
     fIndex(obj.fIndex),
+    fStride(obj.fStride),
     fArraySize(obj.fArraySize),
     fNGenerated(obj.fNGenerated),
     fIsBinFixed(obj.fIsBinFixed),
@@ -260,6 +262,24 @@ void* AliJArrayBase::GetSingleItem(){
     return NULL;
 }
 //_____________________________________________________
+int AliJArrayBase::GetFlatIndex(){
+    // flat index of the current index
+    int iG = 0;
+    for( int i=0;i<Dimension();i++ ) iG += fIndex[i]*fStride[i];
+    return iG;
+}
+//_____________________________________________________
+void* AliJArrayBase::GetItemAt( int iG ){
+    // item at flat index iG, built at first access
+    if( OutOf( iG, 0, fArraySize-1 ) ) JERROR( Form("Wrong flat index %d of ",iG)+GetName() );
+    void * item = *fAlg->GetRawItemAt( iG );
+    if( !item ){
+        fAlg->ReverseIndex( iG ); // name and title of the item are built from the index
+        item = GetItem();
+    }
+    return item;
+}
+//_____________________________________________________
 void AliJArrayBase::FixBin(){
     if( Dimension() == 0 ){
         AddDim(1);SetOption("Single");
@@ -269,6 +289,8 @@ void AliJArrayBase::FixBin(){
     ClearIndex();
     fAlg = new AliJArrayAlgorithmSimple(this);
     fArraySize = fAlg->BuildArray();
+    fStride.resize( Dimension(), 1 );
+    for( int i=Dimension()-2; i>=0; i-- ) fStride[i] = fStride[i+1] * SizeOf(i+1);
 }
 //_____________________________________________________
 int AliJArrayBase::Index(int d){
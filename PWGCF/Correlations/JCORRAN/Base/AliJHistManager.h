@@ -30,6 +30,7 @@ class AliJTH1;
 class AliJHistManager;
 template<typename t> class AliJTH1Derived;
 template<typename t> class AliJTH1DerivedPlayer;
+template<typename t> class AliJTH1DerivedHandle;
 
 //////////////////////////////////////////////////////
 //  Utils
@@ -158,6 +159,18 @@ class AliJArrayBase : public AliJNamed{
         void * GetItem();
         void * GetSingleItem();
 
+        // Flat index access for hot loops. Items are stored in row major order (last index fastest).
+        // No bound check is done on the separate indices, use SetIndex/operator[] in setup code.
+        int    Stride( int d ){ return fStride[d]; }
+        int    GetFlatIndex();
+        int    GetFlatIndex( int i0, int i1=0, int i2=0, int i3=0, int i4=0, int i5=0 ){
+            const int idx[6] = { i0, i1, i2, i3, i4, i5 };
+            int iG = 0;
+            for( int i=0;i<Dimension() && i<6;i++ ) iG += idx[i]*fStride[i];
+            return iG;
+        }
+        void * GetItemAt( int iG );
+
         ///void LockBin(bool is=true){}//TODO
         //bool IsBinLocked(){ return fIsBinLocked; }
 
@@ -185,6 +198,7 @@ class AliJArrayBase : public AliJNamed{
 
         ArrayInt        fDim;           // Comment test
         ArrayInt        fIndex;         /// Comment test
+        ArrayInt        fStride;        // flat index factor of each dimension
         int         fArraySize;         /// Comment test3
         int         fNGenerated;
         bool        fIsBinFixed;
@@ -211,6 +225,8 @@ class AliJArrayAlgorithm {
         virtual void InitIterator()=0;
         virtual bool Next(void *& item) = 0;
         virtual void ** GetRawItem()=0;
+        virtual void ** GetRawItemAt(int iG)=0;
+        virtual void ReverseIndex(int iG)=0;
         virtual void * GetPosition()=0;
         virtual bool IsCurrentPosition(void * pos)=0;
         virtual void SetPosition(void * pos )=0;
@@ -233,6 +249,7 @@ class AliJArrayAlgorithmSimple : public AliJArrayAlgorithm {
         virtual void SetItem(void * item);
         virtual void InitIterator(){ fPos = 0; }
         virtual void ** GetRawItem(){ return &fArray[GlobalIndex()]; }
+        virtual void ** GetRawItemAt(int iG){ return &fArray[iG]; }
         virtual bool Next(void *& item){
             item = fPos<GetEntries()?(void*)fArray[fPos]:NULL;
             if( fPos<GetEntries() ) ReverseIndex(fPos);
@@ -315,6 +332,9 @@ class AliJTH1Derived : public AliJTH1 {
         virtual ~AliJTH1Derived();
 
         AliJTH1DerivedPlayer<T> & operator[](int i){ fPlayer.Init();fPlayer[i];return fPlayer; }
+        // Hot loop access, see AliJArrayBase::GetFlatIndex
+        T * At( int iG ){ return static_cast<T*>(GetItemAt(iG)); }
+        AliJTH1DerivedHandle<T> GetHandle( int iG ){ return AliJTH1DerivedHandle<T>(this, iG); }
         T * operator->(){ return static_cast<T*>(GetSingleItem()); }
         operator T*(){ return static_cast<T*>(GetSingleItem()); }
         // Virtual from AliJArrayBase
@@ -364,11 +384,38 @@ class AliJTH1DerivedPlayer {
         operator T*(){ return static_cast<T*>(fCMD->GetItem()); } 
         operator TObject*(){ return static_cast<TObject*>(fCMD->GetItem()); } 
         operator TH1*(){ return static_cast<TH1*>(fCMD->GetItem()); } 
+        int GetFlatIndex(){
+            if( fLevel != fCMD->Dimension() ) { JERROR(Form("Only %d of %d indices given in ",fLevel,fCMD->Dimension())+fCMD->GetName()); }
+            return fCMD->GetFlatIndex();
+        }
+        AliJTH1DerivedHandle<T> Handle(){ return AliJTH1DerivedHandle<T>(fCMD, GetFlatIndex()); }
     private:
         int fLevel;
         AliJTH1Derived<T> * fCMD;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// AliJTH1DerivedHandle                                                 //
+//////////////////////////////////////////////////////////////////////////
+// Resolved element of an AliJTH1Derived array, e.g. 
+//   AliJTH1DerivedHandle<TH1D> h = fh_vn[ih][ik][fCBin].Handle(); // once, checked
+//   h->Fill( x );                                                 // no index resolution
+// The item is built (or loaded) at the first use as with operator[].
+template< typename T>
+class AliJTH1DerivedHandle {
+    public:
+        AliJTH1DerivedHandle():fCMD(NULL),fIndex(-1),fItem(NULL){}
+        AliJTH1DerivedHandle( AliJTH1Derived<T> * cmd, int iG ):fCMD(cmd),fIndex(iG),fItem(NULL){}
+        T* Get(){ if( !fItem ) fItem = fCMD->At(fIndex); return fItem; }
+        T* operator->(){ return Get(); }
+        operator T*(){ return Get(); }
+        int GetFlatIndex() const { return fIndex; }
+    private:
+        AliJTH1Derived<T> * fCMD;
+        int fIndex;
+        T * fItem;
+};
+
 typedef AliJTH1Derived<TH1D> AliJTH1D;
 typedef AliJTH1Derived<TH2D> AliJTH2D;
 typedef AliJTH1Derived<TProfile> AliJTProfile;
@@ -64,7 +64,8 @@ AliFemtoEvent::AliFemtoEvent():
   fTriggerMask(0),
   fTriggerCluster(0),
   fReactionPlaneAngle(0.0f),
-  fEP(NULL)
+  fEP(NULL),
+  fOwnTracks(true)
 {
   // Default constructor
 
@@ -115,7 +116,8 @@ AliFemtoEvent::AliFemtoEvent(const AliFemtoEvent& ev, AliFemtoTrackCut* tCut, Al
   fTriggerMask(ev.fTriggerMask),
   fTriggerCluster(ev.fTriggerCluster),
   fReactionPlaneAngle(ev.fReactionPlaneAngle),
-  fEP(ev.fEP)
+  fEP(ev.fEP),
+  fOwnTracks(true)
 { // copy constructor with track and v0 cuts
   //cout << "AliFemtoEvent::AliFemtoEvent(const AliFemtoEvent& ev, AliFemtoTrackCut* tCut, AliFemtoV0Cut* vCut, AliFemtoV0Cut* kCut)" << endl;
 
@@ -196,7 +198,8 @@ AliFemtoEvent::AliFemtoEvent(const AliFemtoEvent& ev):
   fTriggerMask(ev.fTriggerMask),
   fTriggerCluster(ev.fTriggerCluster),
   fReactionPlaneAngle(ev.fReactionPlaneAngle),
-  fEP(ev.fEP)
+  fEP(ev.fEP),
+  fOwnTracks(true)
 {
   // copy constructor
   SetPrimVertCov(ev.PrimVertCov());
@@ -275,8 +278,10 @@ AliFemtoEvent& AliFemtoEvent::operator=(const AliFemtoEvent& aEvent)
   fEP = aEvent.fEP;
 
   if (fTrackCollection) {
-    for (AliFemtoTrackIterator iter=fTrackCollection->begin();iter!=fTrackCollection->end();iter++){
-      delete *iter;
+    if (fOwnTracks) {
+      for (AliFemtoTrackIterator iter=fTrackCollection->begin();iter!=fTrackCollection->end();iter++){
+        delete *iter;
+      }
     }
     fTrackCollection->clear();
   } else {
@@ -310,7 +315,8 @@ AliFemtoEvent& AliFemtoEvent::operator=(const AliFemtoEvent& aEvent)
     fKinkCollection = new AliFemtoKinkCollection;
   }
 
-  // copy track collection
+  // copy track collection, the copies are owned
+  fOwnTracks = true;
   for ( AliFemtoTrackIterator tIter=aEvent.fTrackCollection->begin(); tIter!=aEvent.fTrackCollection->end(); tIter++) {
     AliFemtoTrack* trackCopy = new AliFemtoTrack(**tIter);
     fTrackCollection->push_back(trackCopy);
@@ -340,8 +346,10 @@ AliFemtoEvent::~AliFemtoEvent(){
 #ifdef STHBTDEBUG
   cout << " AliFemtoEvent::~AliFemtoEvent() " << endl;
 #endif
-  for (AliFemtoTrackIterator iter=fTrackCollection->begin();iter!=fTrackCollection->end();iter++){
-    delete *iter;
+  if (fOwnTracks) {
+    for (AliFemtoTrackIterator iter=fTrackCollection->begin();iter!=fTrackCollection->end();iter++){
+      delete *iter;
+    }
   }
   fTrackCollection->clear();
   delete fTrackCollection;
@@ -410,6 +418,8 @@ AliFemtoV0Collection* AliFemtoEvent::V0Collection() const {return fV0Collection;
 AliFemtoXiCollection* AliFemtoEvent::XiCollection() const {return fXiCollection;}
 AliFemtoKinkCollection* AliFemtoEvent::KinkCollection() const {return fKinkCollection;}
 AliFemtoTrackCollection* AliFemtoEvent::TrackCollection() const {return fTrackCollection;}
+bool AliFemtoEvent::OwnsTracks() const {return fOwnTracks;}
+void AliFemtoEvent::SetOwnsTracks(bool own) {fOwnTracks = own;}
 AliFemtoThreeVector AliFemtoEvent::PrimVertPos() const {return fPrimVertPos;}
 const double* AliFemtoEvent::PrimVertCov() const {return fPrimVertCov;}
 double AliFemtoEvent::MagneticField() const {return fMagneticField;}
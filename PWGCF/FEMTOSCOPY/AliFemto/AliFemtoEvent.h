@@ -39,6 +39,13 @@ public:
   AliFemtoXiCollection* XiCollection() const;
   AliFemtoKinkCollection* KinkCollection() const;
   AliFemtoTrackCollection* TrackCollection() const;
+
+  /// Tracks of the collection are deleted with the event (default). The
+  /// reader can keep the ownership of the tracks, e.g. to reuse them for
+  /// the next event; copies of the event always own their tracks.
+  bool OwnsTracks() const;
+  void SetOwnsTracks(bool own);
+
   double MagneticField() const;
   bool IsCollisionCandidate() const;
 
@@ -172,6 +179,8 @@ private:
 
   Float_t         fReactionPlaneAngle;  ///< reconstructed reaction plane angle
   AliEventplane*  fEP;                  ///< pointer to full event plane information
+
+  bool            fOwnTracks;           ///< the tracks of fTrackCollection are deleted with the event
 };
 
 
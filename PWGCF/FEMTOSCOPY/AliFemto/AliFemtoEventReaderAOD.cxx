@@ -94,13 +94,23 @@ AliFemtoEventReaderAOD::AliFemtoEventReaderAOD():
   fIsKaonAnalysis(kFALSE),
   fIsProtonAnalysis(kFALSE),
   fIsPionAnalysis(kFALSE),
-  fIsElectronAnalysis(kFALSE)
+  fIsElectronAnalysis(kFALSE),
+  fTrackFields(kTrackAllFields),
+  fUseTrackPreCuts(kFALSE),
+  fUseTrackPool(kFALSE),
+  fTrackPoolActive(kFALSE),
+  fTrackPool(),
+  fNPoolTracksUsed(0)
 {
   // default constructor
   fAllTrue.ResetAllBits(kTRUE);
   fAllFalse.ResetAllBits(kFALSE);
   fCentRange[0] = 0;
   fCentRange[1] = 1000;
+  fPreCutPt[0] = 0;
+  fPreCutPt[1] = 1e9;
+  fPreCutEta[0] = -1e9;
+  fPreCutEta[1] = 1e9;
 }
 
 AliFemtoEventReaderAOD::AliFemtoEventReaderAOD(const AliFemtoEventReaderAOD &aReader):
@@ -148,7 +158,13 @@ AliFemtoEventReaderAOD::AliFemtoEventReaderAOD(const AliFemtoEventReaderAOD &aRe
   fIsKaonAnalysis(aReader.fIsKaonAnalysis),
   fIsProtonAnalysis(aReader.fIsProtonAnalysis),
   fIsPionAnalysis(aReader.fIsPionAnalysis),
-  fIsElectronAnalysis(aReader.fIsElectronAnalysis)
+  fIsElectronAnalysis(aReader.fIsElectronAnalysis),
+  fTrackFields(aReader.fTrackFields),
+  fUseTrackPreCuts(aReader.fUseTrackPreCuts),
+  fUseTrackPool(aReader.fUseTrackPool),
+  fTrackPoolActive(kFALSE),
+  fTrackPool(),
+  fNPoolTracksUsed(0)
 
 {
   // copy constructor
@@ -159,6 +175,10 @@ AliFemtoEventReaderAOD::AliFemtoEventReaderAOD(const AliFemtoEventReaderAOD &aRe
 
   fCentRange[0] = aReader.fCentRange[0];
   fCentRange[1] = aReader.fCentRange[1];
+  fPreCutPt[0] = aReader.fPreCutPt[0];
+  fPreCutPt[1] = aReader.fPreCutPt[1];
+  fPreCutEta[0] = aReader.fPreCutEta[0];
+  fPreCutEta[1] = aReader.fPreCutEta[1];
 }
 //__________________
 AliFemtoEventReaderAOD::~AliFemtoEventReaderAOD()
@@ -166,6 +186,9 @@ AliFemtoEventReaderAOD::~AliFemtoEventReaderAOD()
   delete fTree;
   delete fEvent;
   delete fAodFile;
+  for (size_t i = 0; i < fTrackPool.size(); i++) {
+    delete fTrackPool[i];
+  }
 //   if (fPWG2AODTracks) {
 //     fPWG2AODTracks->Delete();
 //     delete fPWG2AODTracks;
@@ -223,6 +246,13 @@ AliFemtoEventReaderAOD &AliFemtoEventReaderAOD::operator=(const AliFemtoEventRea
   fIsProtonAnalysis = aReader.fIsProtonAnalysis;
   fIsPionAnalysis = aReader.fIsPionAnalysis;
   fIsElectronAnalysis = aReader.fIsElectronAnalysis;
+  fTrackFields = aReader.fTrackFields;
+  fUseTrackPreCuts = aReader.fUseTrackPreCuts;
+  fPreCutPt[0] = aReader.fPreCutPt[0];
+  fPreCutPt[1] = aReader.fPreCutPt[1];
+  fPreCutEta[0] = aReader.fPreCutEta[0];
+  fPreCutEta[1] = aReader.fPreCutEta[1];
+  fUseTrackPool = aReader.fUseTrackPool;
 
   return *this;
 }
@@ -430,8 +460,12 @@ AliFemtoEvent *AliFemtoEventReaderAOD::CopyAODtoFemtoEvent()
   // i.e. labels[Event->GetTrack(x)->GetID()] == x
   std::map<int, int> labels;
 
+  // only needed for the PID of TPC-only tracks
+  const bool copyPID = (fTrackFields & kTrackPID);
+  const bool copyMC = (fTrackFields & kTrackMC) || fIsKaonAnalysis || fIsProtonAnalysis || fIsPionAnalysis || fIsElectronAnalysis;
+
   // looking for global tracks and saving their numbers to copy from them PID information to TPC-only tracks in the main loop over tracks
-  for (int i = 0; i < nofTracks; i++) {
+  for (int i = 0; copyPID && i < nofTracks; i++) {
     const AliAODTrack *aodtrack = dynamic_cast<const AliAODTrack *>(fEvent->GetTrack(i));
     assert(aodtrack && "Not a standard AOD");
     if (!aodtrack->TestFilterBit(fFilterBit)) {
@@ -441,6 +475,13 @@ AliFemtoEvent *AliFemtoEventReaderAOD::CopyAODtoFemtoEvent()
     }
   }
 
+  // the tracks of the pool are reused for this event
+  fTrackPoolActive = fUseTrackPool;
+  fNPoolTracksUsed = 0;
+  if (fUseTrackPool) {
+    tEvent->SetOwnsTracks(false);
+  }
+
   int tNormMult = 0;
   for (int i = 0; i < nofTracks; i++) {
 
@@ -470,6 +511,15 @@ AliFemtoEvent *AliFemtoEventReaderAOD::CopyAODtoFemtoEvent()
               tNormMult++;
     }
 
+    // cheap kinematic selection before the conversion
+    if (fUseTrackPreCuts) {
+      const double pt = aodtrack->Pt(),
+                   eta = aodtrack->Eta();
+      if (pt < fPreCutPt[0] || pt > fPreCutPt[1] || eta < fPreCutEta[0] || eta > fPreCutEta[1]) {
+        continue;
+      }
+    }
+
     AliFemtoTrack *trackCopy = CopyAODtoFemtoTrack(aodtrack);
 
     // copying PID information from the correspondent track
@@ -477,15 +527,17 @@ AliFemtoEvent *AliFemtoEventReaderAOD::CopyAODtoFemtoEvent()
 
 
     // For TPC Only tracks we have to copy PID information from corresponding global tracks
-    const Int_t pid_track_id = (fFilterBit == (1 << 7) || fFilterMask == 128)
-                             ? labels[-1 - fEvent->GetTrack(i)->GetID()]
-                             : i;
-    AliAODTrack *aodtrackpid = dynamic_cast<AliAODTrack *>(fEvent->GetTrack(pid_track_id));
-    assert(aodtrackpid && "Not a standard AOD");
-
-    CopyPIDtoFemtoTrack(aodtrackpid, trackCopy);
+    if (copyPID) {
+      const Int_t pid_track_id = (fFilterBit == (1 << 7) || fFilterMask == 128)
+                               ? labels[-1 - fEvent->GetTrack(i)->GetID()]
+                               : i;
+      AliAODTrack *aodtrackpid = dynamic_cast<AliAODTrack *>(fEvent->GetTrack(pid_track_id));
+      assert(aodtrackpid && "Not a standard AOD");
+
+      CopyPIDtoFemtoTrack(aodtrackpid, trackCopy);
+    }
 
-    if (mcP) {
+    if (mcP && copyMC) {
 
       // Fill the hidden information with the simulated data
       Int_t track_label = aodtrack->GetLabel();
@@ -648,7 +700,7 @@ AliFemtoEvent *AliFemtoEventReaderAOD::CopyAODtoFemtoEvent()
       }
       else {
 	// cout<<"bad track : AOD REader pdg cod"<<pdg<<" ptrue "<<ptrue<<endl;
-	delete  trackCopy;
+	ReleaseFemtoTrack(trackCopy);
       }
       //Special MC analysis for pi,K,p,e slected by PDG code <--
     }
@@ -657,6 +709,7 @@ AliFemtoEvent *AliFemtoEventReaderAOD::CopyAODtoFemtoEvent()
       realnofTracks++; // Real number of tracks
     }
   }
+  fTrackPoolActive = kFALSE;
   //cout<<"======================> realnofTracks"<<realnofTracks<<endl;
   tEvent->SetNumberOfTracks(realnofTracks); // Setting number of track which we read in event
 
@@ -864,7 +917,7 @@ AliFemtoTrack *AliFemtoEventReaderAOD::CopyAODtoFemtoTrack(AliAODTrack *tAodTrac
 {
   // Copy the track information from the AOD into the internal AliFemtoTrack
   // If it exists, use the additional information from the PWG2 AOD
-  AliFemtoTrack *tFemtoTrack = new AliFemtoTrack();
+  AliFemtoTrack *tFemtoTrack = NewFemtoTrack();
 
   // Primary Vertex position
 
@@ -917,58 +970,62 @@ AliFemtoTrack *AliFemtoEventReaderAOD::CopyAODtoFemtoTrack(AliAODTrack *tAodTrac
   tFemtoTrack->SetTPCsignalN(1);
   tFemtoTrack->SetTPCsignalS(1);
   tFemtoTrack->SetTPCsignal(tAodTrack->GetTPCsignal());
-  tFemtoTrack->SetTPCClusterMap(tAodTrack->GetTPCClusterMap());
-  tFemtoTrack->SetTPCSharedMap(tAodTrack->GetTPCSharedMap());
-
-  float globalPositionsAtRadii[9][3];
-  float bfield = 5 * fMagFieldSign;
-
-  GetGlobalPositionAtGlobalRadiiThroughTPC(tAodTrack, bfield, globalPositionsAtRadii);
-  double tpcEntrance[3] = {globalPositionsAtRadii[0][0], globalPositionsAtRadii[0][1], globalPositionsAtRadii[0][2]};
-  double **tpcPositions;
-  tpcPositions = new double*[9];
-
-  for (int i = 0; i < 9; i++) {
-    tpcPositions[i] = new double[3];
+  if (fTrackFields & kTrackTPCMaps) {
+    tFemtoTrack->SetTPCClusterMap(tAodTrack->GetTPCClusterMap());
+    tFemtoTrack->SetTPCSharedMap(tAodTrack->GetTPCSharedMap());
   }
 
-  double tpcExit[3] = {globalPositionsAtRadii[8][0], globalPositionsAtRadii[8][1], globalPositionsAtRadii[8][2]};
-  for (int i = 0; i < 9; i++) {
-    tpcPositions[i][0] = globalPositionsAtRadii[i][0];
-    tpcPositions[i][1] = globalPositionsAtRadii[i][1];
-    tpcPositions[i][2] = globalPositionsAtRadii[i][2];
-  }
+  if (fTrackFields & kTrackTPCPoints) {
+    float globalPositionsAtRadii[9][3];
+    float bfield = 5 * fMagFieldSign;
 
-  if (fPrimaryVertexCorrectionTPCPoints) {
-    tpcEntrance[0] -= fV1[0];
-    tpcEntrance[1] -= fV1[1];
-    tpcEntrance[2] -= fV1[2];
+    GetGlobalPositionAtGlobalRadiiThroughTPC(tAodTrack, bfield, globalPositionsAtRadii);
+    double tpcEntrance[3] = {globalPositionsAtRadii[0][0], globalPositionsAtRadii[0][1], globalPositionsAtRadii[0][2]};
+    double **tpcPositions;
+    tpcPositions = new double*[9];
 
-    tpcExit[0] -= fV1[0];
-    tpcExit[1] -= fV1[1];
-    tpcExit[2] -= fV1[2];
+    for (int i = 0; i < 9; i++) {
+      tpcPositions[i] = new double[3];
+    }
 
+    double tpcExit[3] = {globalPositionsAtRadii[8][0], globalPositionsAtRadii[8][1], globalPositionsAtRadii[8][2]};
     for (int i = 0; i < 9; i++) {
-      tpcPositions[i][0] -= fV1[0];
-      tpcPositions[i][1] -= fV1[1];
-      tpcPositions[i][2] -= fV1[2];
+      tpcPositions[i][0] = globalPositionsAtRadii[i][0];
+      tpcPositions[i][1] = globalPositionsAtRadii[i][1];
+      tpcPositions[i][2] = globalPositionsAtRadii[i][2];
+    }
+
+    if (fPrimaryVertexCorrectionTPCPoints) {
+      tpcEntrance[0] -= fV1[0];
+      tpcEntrance[1] -= fV1[1];
+      tpcEntrance[2] -= fV1[2];
+
+      tpcExit[0] -= fV1[0];
+      tpcExit[1] -= fV1[1];
+      tpcExit[2] -= fV1[2];
+
+      for (int i = 0; i < 9; i++) {
+        tpcPositions[i][0] -= fV1[0];
+        tpcPositions[i][1] -= fV1[1];
+        tpcPositions[i][2] -= fV1[2];
+      }
     }
-  }
 
-  tFemtoTrack->SetNominalTPCEntrancePoint(tpcEntrance);
-  tFemtoTrack->SetNominalTPCPoints(tpcPositions);
-  tFemtoTrack->SetNominalTPCExitPoint(tpcExit);
+    tFemtoTrack->SetNominalTPCEntrancePoint(tpcEntrance);
+    tFemtoTrack->SetNominalTPCPoints(tpcPositions);
+    tFemtoTrack->SetNominalTPCExitPoint(tpcExit);
 
-  if (fShiftPosition > 0.) {
-    Float_t posShifted[3];
-    SetShiftedPositions(tAodTrack, bfield, posShifted, fShiftPosition);
-    tFemtoTrack->SetNominalTPCPointShifted(posShifted);
-  }
+    if (fShiftPosition > 0.) {
+      Float_t posShifted[3];
+      SetShiftedPositions(tAodTrack, bfield, posShifted, fShiftPosition);
+      tFemtoTrack->SetNominalTPCPointShifted(posShifted);
+    }
 
-  for (int i = 0; i < 9; i++) {
-    delete [] tpcPositions[i];
+    for (int i = 0; i < 9; i++) {
+      delete [] tpcPositions[i];
+    }
+    delete [] tpcPositions;
   }
-  delete [] tpcPositions;
 
 
   int indexes[3];
@@ -983,6 +1040,10 @@ AliFemtoTrack *AliFemtoEventReaderAOD::CopyAODtoFemtoTrack(AliAODTrack *tAodTrac
   }
 
   //Corrections
+  if (!(fTrackFields & kTrackCorrections)) {
+    return tFemtoTrack;
+  }
+
   if(f1DcorrectionsPions){
     tFemtoTrack->SetCorrectionPion(f1DcorrectionsPions->GetBinContent(f1DcorrectionsPions->FindFixBin(tAodTrack->Pt())));
   }
@@ -1977,3 +2038,51 @@ void AliFemtoEventReaderAOD::SetElectronAnalysis(Bool_t aSetElectronAna)
   fIsElectronAnalysis = aSetElectronAna;
 }
 //Special MC analysis for pi,K,p,e selected by PDG code <--
+
+void AliFemtoEventReaderAOD::SetTrackFields(UInt_t fields)
+{
+  fTrackFields = fields;
+}
+
+void AliFemtoEventReaderAOD::SetTrackPreCuts(double ptMin, double ptMax, double etaMin, double etaMax)
+{
+  fUseTrackPreCuts = kTRUE;
+  fPreCutPt[0] = ptMin;
+  fPreCutPt[1] = ptMax;
+  fPreCutEta[0] = etaMin;
+  fPreCutEta[1] = etaMax;
+}
+
+void AliFemtoEventReaderAOD::SetUseTrackPool(Bool_t usePool)
+{
+  fUseTrackPool = usePool;
+}
+
+AliFemtoTrack *AliFemtoEventReaderAOD::NewFemtoTrack()
+{
+  // A track to be filled, taken from the pool (reset to the default
+  // values) while converting the tracks of an event with the pool on
+  if (!fTrackPoolActive) {
+    return new AliFemtoTrack();
+  }
+
+  if (fNPoolTracksUsed == fTrackPool.size()) {
+    fTrackPool.push_back(new AliFemtoTrack());
+    return fTrackPool[fNPoolTracksUsed++];
+  }
+
+  static const AliFemtoTrack kDefaultTrack;
+  AliFemtoTrack *track = fTrackPool[fNPoolTracksUsed++];
+  *track = kDefaultTrack;
+  return track;
+}
+
+void AliFemtoEventReaderAOD::ReleaseFemtoTrack(AliFemtoTrack *track)
+{
+  // Give back the last track obtained from NewFemtoTrack()
+  if (fTrackPoolActive && fNPoolTracksUsed > 0 && fTrackPool[fNPoolTracksUsed - 1] == track) {
+    fNPoolTracksUsed--;
+  } else {
+    delete track;
+  }
+}
@@ -41,6 +41,16 @@ public:
                  };
   typedef enum EventMult EstEventMult;
 
+  /// Groups of track information converted from the AOD, the others
+  /// (kinematics, helix, flags, DCA, cluster counts, ITS hits) are always filled
+  enum TrackField {kTrackPID = 1 << 0,         ///< PID signals and nsigmas (CopyPIDtoFemtoTrack)
+                   kTrackTPCPoints = 1 << 1,   ///< nominal TPC entrance, exit and intermediate points, shifted position
+                   kTrackTPCMaps = 1 << 2,     ///< TPC cluster and shared maps
+                   kTrackMC = 1 << 3,          ///< MC hidden information (if MC is read)
+                   kTrackCorrections = 1 << 4, ///< pT dependent corrections
+                   kTrackAllFields = 0x1f
+                  };
+
   AliFemtoEventReaderAOD();
   AliFemtoEventReaderAOD(const AliFemtoEventReaderAOD &aReader);
   virtual ~AliFemtoEventReaderAOD();
@@ -98,7 +108,16 @@ public:
   void SetProtonAnalysis(Bool_t aSetProtonAna);
   void SetElectronAnalysis(Bool_t aSetElectronAna);
   //Special MC analysis for pi,K,p,e slected by PDG code <--
-  
+
+  /// Declare the track information needed by the cuts and correlation
+  /// functions (OR of TrackField), default kTrackAllFields
+  void SetTrackFields(UInt_t fields);
+  /// Reject AOD tracks outside these ranges before converting them
+  void SetTrackPreCuts(double ptMin, double ptMax, double etaMin, double etaMax);
+  /// Convert the tracks into a buffer reused from event to event instead
+  /// of new objects; an event is then valid until the next one is read
+  void SetUseTrackPool(Bool_t usePool);
+
 protected:
   virtual AliFemtoEvent *CopyAODtoFemtoEvent();
   virtual AliFemtoTrack *CopyAODtoFemtoTrack(AliAODTrack *tAodTrack
@@ -107,6 +126,8 @@ protected:
   virtual AliFemtoV0 *CopyAODtoFemtoV0(AliAODv0 *tAODv0);
   virtual AliFemtoXi *CopyAODtoFemtoXi(AliAODcascade *tAODxi);
   virtual void CopyPIDtoFemtoTrack(AliAODTrack *tAodTrack, AliFemtoTrack *tFemtoTrack);
+  AliFemtoTrack *NewFemtoTrack();
+  void ReleaseFemtoTrack(AliFemtoTrack *track);
 
   int            fNumberofEvent;    ///< number of Events in AOD file
   int            fCurEvent;         ///< number of current event
@@ -164,10 +185,19 @@ private:
   Bool_t fIsElectronAnalysis; // e+e- are taken (for gamma cut tuning)
   //Special MC analysis for pi,K,p,e slected by PDG code <--
 
+  UInt_t fTrackFields;          ///< track information to convert, OR of TrackField
+  Bool_t fUseTrackPreCuts;      ///< apply the pt and eta pre-cuts on the AOD tracks
+  Double_t fPreCutPt[2];        ///< pt range of the pre-cuts
+  Double_t fPreCutEta[2];       ///< eta range of the pre-cuts
+  Bool_t fUseTrackPool;         ///< reuse the converted tracks from event to event
+  Bool_t fTrackPoolActive;      //!<! NewFemtoTrack() takes the tracks from the pool
+  std::vector<AliFemtoTrack*> fTrackPool; //!<! tracks owned by the reader
+  size_t fNPoolTracksUsed;      //!<! tracks of the pool used by the current event
+
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
-  ClassDef(AliFemtoEventReaderAOD, 12);
+  ClassDef(AliFemtoEventReaderAOD, 13);
   /// \endcond
 #endif
 
@@ -8,10 +8,25 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include "AliFemtoManager.h"
+#include "AliFemtoSimpleAnalysis.h"
+#include "AliFemtoParticleCutCache.h"
 //#include "AliFemtoParticleCollection.h"
 //#include "AliFemtoTrackCut.h"
 //#include "AliFemtoV0Cut.h"
 #include <cstdio>
+#include <map>
+#include <vector>
+
+#if __cplusplus >= 201103L
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#ifdef __ROOT__
+#include <RVersion.h>
+#include <TROOT.h>
+#endif
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -19,23 +34,243 @@
   /// \endcond
 #endif
 
+typedef std::vector< std::vector<AliFemtoAnalysis*> > AliFemtoAnalysisGroups;
+
+#if __cplusplus >= 201103L
+/// Threads processing groups of analyses on an event. The groups are
+/// independent, the analyses of a group are processed in order by
+/// the same thread. The thread calling Run() takes part in the work.
+class AliFemtoAnalysisThreadPool {
+public:
+  explicit AliFemtoAnalysisThreadPool(int nThreads);
+  ~AliFemtoAnalysisThreadPool();
+
+  void Run(const AliFemtoAnalysisGroups &groups, AliFemtoEvent *event);
+
+private:
+  AliFemtoAnalysisThreadPool(const AliFemtoAnalysisThreadPool &);
+  AliFemtoAnalysisThreadPool& operator=(const AliFemtoAnalysisThreadPool &);
+
+  void Work();
+  void ProcessGroups();
+
+  std::vector<std::thread> fThreads;
+  std::mutex fMutex;
+  std::condition_variable fStart;
+  std::condition_variable fDone;
+  const AliFemtoAnalysisGroups *fGroups;
+  AliFemtoEvent *fEvent;
+  size_t fNextGroup;
+  size_t fNDoneGroups;
+  unsigned long fRun;
+  bool fStop;
+};
+
+AliFemtoAnalysisThreadPool::AliFemtoAnalysisThreadPool(int nThreads):
+  fThreads(),
+  fMutex(),
+  fStart(),
+  fDone(),
+  fGroups(NULL),
+  fEvent(NULL),
+  fNextGroup(0),
+  fNDoneGroups(0),
+  fRun(0),
+  fStop(false)
+{
+#ifdef __ROOT__
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
+#endif
+  for (int i = 1; i < nThreads; i++) {
+    fThreads.push_back(std::thread(&AliFemtoAnalysisThreadPool::Work, this));
+  }
+}
+
+AliFemtoAnalysisThreadPool::~AliFemtoAnalysisThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fStop = true;
+  }
+  fStart.notify_all();
+  for (size_t i = 0; i < fThreads.size(); i++) {
+    fThreads[i].join();
+  }
+}
+
+void AliFemtoAnalysisThreadPool::Run(const AliFemtoAnalysisGroups &groups, AliFemtoEvent *event)
+{
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fGroups = &groups;
+    fEvent = event;
+    fNextGroup = 0;
+    fNDoneGroups = 0;
+    fRun++;
+  }
+  fStart.notify_all();
+
+  ProcessGroups();
+
+  std::unique_lock<std::mutex> lock(fMutex);
+  fDone.wait(lock, [this] { return fNDoneGroups == fGroups->size(); });
+  fGroups = NULL;
+  fEvent = NULL;
+}
+
+void AliFemtoAnalysisThreadPool::ProcessGroups()
+{
+  // take the next group until none is left
+  std::unique_lock<std::mutex> lock(fMutex);
+  while (fGroups && fNextGroup < fGroups->size()) {
+    const std::vector<AliFemtoAnalysis*> &group = (*fGroups)[fNextGroup++];
+    AliFemtoEvent *event = fEvent;
+    lock.unlock();
+
+    for (size_t i = 0; i < group.size(); i++) {
+      group[i]->ProcessEvent(event);
+    }
+
+    lock.lock();
+    if (++fNDoneGroups == fGroups->size()) {
+      fDone.notify_all();
+    }
+  }
+}
+
+void AliFemtoAnalysisThreadPool::Work()
+{
+  unsigned long lastRun = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fStart.wait(lock, [this, lastRun] { return fStop || fRun != lastRun; });
+      if (fStop) {
+        return;
+      }
+      lastRun = fRun;
+    }
+    ProcessGroups();
+  }
+}
+#else
+class AliFemtoAnalysisThreadPool { };
+#endif
+
+/// Add the cut and its monitors to the objects of an analysis
+static void AddCutObjects(AliFemtoCutMonitorHandler *cut, std::vector<const void*> &objects)
+{
+  if (!cut) {
+    return;
+  }
+  objects.push_back(cut);
+  AliFemtoCutMonitorCollection *monitors[2] = {cut->PassMonitorColl(), cut->FailMonitorColl()};
+  for (int i = 0; i < 2; i++) {
+    if (!monitors[i]) {
+      continue;
+    }
+    for (AliFemtoCutMonitorIterator iter = monitors[i]->begin(); iter != monitors[i]->end(); ++iter) {
+      objects.push_back(*iter);
+    }
+  }
+}
+
+/// Split the analyses into groups which can be processed concurrently:
+/// analyses sharing a cut, a cut monitor or a correlation function are
+/// in the same group, as well as all the analyses not deriving from
+/// AliFemtoSimpleAnalysis (their objects are not known). The groups,
+/// and the analyses in each group, are in the order of the collection.
+static void GroupAnalyses(AliFemtoAnalysisCollection *analyses, AliFemtoAnalysisGroups &groups)
+{
+  std::vector<AliFemtoAnalysis*> list(analyses->begin(), analyses->end());
+  const int nAnalyses = list.size();
+
+  std::vector<int> parent(nAnalyses);
+  for (int i = 0; i < nAnalyses; i++) {
+    parent[i] = i;
+  }
+
+  std::map<const void*, int> owner;
+  std::vector<const void*> objects;
+  int firstOther = -1;
+  for (int i = 0; i < nAnalyses; i++) {
+    AliFemtoSimpleAnalysis *analysis = dynamic_cast<AliFemtoSimpleAnalysis*>(list[i]);
+    objects.clear();
+    if (analysis) {
+      AddCutObjects(analysis->EventCut(), objects);
+      AddCutObjects(analysis->FirstParticleCut(), objects);
+      AddCutObjects(analysis->SecondParticleCut(), objects);
+      AddCutObjects(analysis->PairCut(), objects);
+      AliFemtoCorrFctnCollection *functions = analysis->CorrFctnCollection();
+      for (AliFemtoCorrFctnIterator iter = functions->begin(); iter != functions->end(); ++iter) {
+        objects.push_back(*iter);
+      }
+    } else if (firstOther < 0) {
+      firstOther = i;
+    } else {
+      objects.push_back(list[firstOther]);
+    }
+
+    for (size_t j = 0; j < objects.size(); j++) {
+      std::map<const void*, int>::iterator found = owner.find(objects[j]);
+      if (found == owner.end()) {
+        owner[objects[j]] = i;
+        continue;
+      }
+      // merge the two groups, the root is the first analysis
+      int a = found->second, b = i;
+      while (parent[a] != a) a = parent[a];
+      while (parent[b] != b) b = parent[b];
+      if (a != b) {
+        parent[a > b ? a : b] = a < b ? a : b;
+      }
+    }
+    if (!analysis && firstOther == i) {
+      owner[list[i]] = i;
+    }
+  }
+
+  groups.clear();
+  std::vector<int> groupOfRoot(nAnalyses, -1);
+  for (int i = 0; i < nAnalyses; i++) {
+    int root = i;
+    while (parent[root] != root) root = parent[root];
+    if (groupOfRoot[root] < 0) {
+      groupOfRoot[root] = groups.size();
+      groups.push_back(std::vector<AliFemtoAnalysis*>());
+    }
+    groups[groupOfRoot[root]].push_back(list[i]);
+  }
+}
+
 
 
 //____________________________
 AliFemtoManager::AliFemtoManager():
   fAnalysisCollection(NULL),
   fEventReader(NULL),
-  fEventWriterCollection(NULL)
+  fEventWriterCollection(NULL),
+  fParticleCutCache(NULL),
+  fShareParticleCuts(true),
+  fNThreads(1),
+  fThreadPool(NULL)
 {
   // default constructor
   fAnalysisCollection = new AliFemtoAnalysisCollection;
   fEventWriterCollection = new AliFemtoEventWriterCollection;
+  fParticleCutCache = new AliFemtoParticleCutCache;
 }
 //____________________________
 AliFemtoManager::AliFemtoManager(const AliFemtoManager& aManager):
   fAnalysisCollection(new AliFemtoAnalysisCollection),
   fEventReader(aManager.fEventReader),
-  fEventWriterCollection(new AliFemtoEventWriterCollection)
+  fEventWriterCollection(new AliFemtoEventWriterCollection),
+  fParticleCutCache(new AliFemtoParticleCutCache),
+  fShareParticleCuts(aManager.fShareParticleCuts),
+  fNThreads(aManager.fNThreads),
+  fThreadPool(NULL)
 {
   // copy constructor
   AliFemtoSimpleAnalysisIterator tAnalysisIter;
@@ -65,6 +300,8 @@ AliFemtoManager::~AliFemtoManager()
     delete *tEventWriterIter;
   }
   delete fEventWriterCollection;
+  delete fParticleCutCache;
+  delete fThreadPool;
 }
 //____________________________
 AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
@@ -75,6 +312,8 @@ AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
   }
 
   fEventReader = aManager.fEventReader;
+  fShareParticleCuts = aManager.fShareParticleCuts;
+  SetNumberOfThreads(aManager.fNThreads);
   AliFemtoSimpleAnalysisIterator tAnalysisIter;
   if (fAnalysisCollection) {
     for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
@@ -105,6 +344,26 @@ AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
   return *this;
 }
 
+//____________________________
+void AliFemtoManager::SetNumberOfThreads(int n)
+{
+  // set the number of threads processing the analyses, the threads
+  // are started at the first event
+#if __cplusplus < 201103L
+  if (n > 1) {
+    cout << " AliFemtoManager::SetNumberOfThreads() - no thread support (C++11), analyses are processed serially" << endl;
+    n = 1;
+  }
+#endif
+  if (n < 1) {
+    n = 1;
+  }
+  if (n != fNThreads) {
+    delete fThreadPool;
+    fThreadPool = NULL;
+  }
+  fNThreads = n;
+}
 //____________________________
 int AliFemtoManager::Init()
 {
@@ -241,10 +500,37 @@ int AliFemtoManager::ProcessEvent()
     (*tEventWriterIter)->WriteHbtEvent(currentHbtEvent);
   }
 
-  // loop over all the Analysis
+  // particle cut decisions of the previous event are obsolete
+  fParticleCutCache->NewEvent();
+
+  // the cut decisions are not shared by analyses processed in parallel
+  const bool parallel = fNThreads > 1 && fAnalysisCollection->size() > 1;
+  AliFemtoParticleCutCache *cutCache = (fShareParticleCuts && !parallel) ? fParticleCutCache : NULL;
+
+  // analyses may have been added since the last event
   AliFemtoSimpleAnalysisIterator tAnalysisIter;
   for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
-    (*tAnalysisIter)->ProcessEvent(currentHbtEvent);
+    AliFemtoSimpleAnalysis *simpleAnalysis = dynamic_cast<AliFemtoSimpleAnalysis*>(*tAnalysisIter);
+    if (simpleAnalysis) {
+      simpleAnalysis->SetParticleCutCache(cutCache);
+    }
+  }
+
+#if __cplusplus >= 201103L
+  if (parallel) {
+    if (!fThreadPool) {
+      fThreadPool = new AliFemtoAnalysisThreadPool(fNThreads);
+    }
+    AliFemtoAnalysisGroups groups;
+    GroupAnalyses(fAnalysisCollection, groups);
+    fThreadPool->Run(groups, currentHbtEvent);
+  } else
+#endif
+  {
+    // loop over all the Analysis
+    for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
+      (*tAnalysisIter)->ProcessEvent(currentHbtEvent);
+    }
   }
 
   if (currentHbtEvent) {
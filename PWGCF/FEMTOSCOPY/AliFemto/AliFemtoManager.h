@@ -19,6 +19,9 @@
 #include "AliFemtoEventReader.h"
 #include "AliFemtoEventWriter.h"
 
+class AliFemtoParticleCutCache;
+class AliFemtoAnalysisThreadPool;
+
 
 /// \class AliFemtoManager
 /// \brief Main class for managing femtoscopic analyses
@@ -33,6 +36,29 @@
 /// in each output analysis, which is responsible for carrying out the
 /// actual cuts & computation.
 ///
+/// The decisions of the particle cuts are shared between the analyses
+/// deriving from AliFemtoSimpleAnalysis: a cut object used by several
+/// analyses, or equivalent cuts (see AliFemtoParticleCut::SelectionKey),
+/// is evaluated only once per event. This can be switched off with
+/// `SetShareParticleCuts(false)`.
+///
+/// With `SetNumberOfThreads(n)`, n > 1, the analyses are processed by a
+/// pool of n threads (the calling thread included); this requires C++11,
+/// otherwise the analyses are processed serially. The contract is:
+///
+/// - the event is read-only for the analyses,
+/// - analyses sharing a cut, correlation function or cut monitor object
+///   are processed by the same thread, in the order of the collection;
+///   analyses not deriving from AliFemtoSimpleAnalysis are all processed
+///   by the same thread. Other objects (e.g. a histogram filled by
+///   correlation functions of two analyses) must not be shared,
+/// - cuts and correlation functions must not use global mutable state
+///   (e.g. the YKP pair variables, which use rand()),
+/// - the particle cut decisions are not shared between analyses.
+///
+/// Within these rules the results are identical to the serial processing,
+/// as each analysis sees the same sequence of calls as before.
+///
 /// AliFemtoManager objects "own" the EventReader, Analyses, and
 /// EventWriters added to them, and is responsible for deleting them
 /// upon its own destruction.
@@ -49,6 +75,10 @@ private:
   AliFemtoAnalysisCollection* fAnalysisCollection;       ///< Collection of analyzes
   AliFemtoEventReader*        fEventReader;              ///< Event reader
   AliFemtoEventWriterCollection* fEventWriterCollection; ///< Event writer collection
+  AliFemtoParticleCutCache*   fParticleCutCache;         //!<! Per event particle cut decisions shared by the analyses
+  bool                        fShareParticleCuts;        ///< Share the particle cut decisions between analyses
+  int                         fNThreads;                 ///< Number of threads processing the analyses, <= 1 for serial
+  AliFemtoAnalysisThreadPool* fThreadPool;               //!<! Threads processing the analyses
 
 public:
   AliFemtoManager();
@@ -70,6 +100,12 @@ public:
   AliFemtoEventReader* EventReader();
   void SetEventReader(AliFemtoEventReader* r);
 
+  void SetShareParticleCuts(bool share);       ///< Evaluate equivalent particle cuts once per event (default true)
+  bool ShareParticleCuts() const;
+
+  void SetNumberOfThreads(int n);              ///< Process the analyses with n threads (default 1, serial)
+  int NumberOfThreads() const;
+
   /// Calls `Init()` on all owned EventWriters
   ///
   /// Returns 0 for success, 1 for failure.
@@ -99,4 +135,9 @@ inline void AliFemtoManager::SetEventWriter(AliFemtoEventWriter* writer){fEventW
 inline AliFemtoEventReader* AliFemtoManager::EventReader(){return fEventReader;}
 inline void AliFemtoManager::SetEventReader(AliFemtoEventReader* reader){fEventReader = reader;}
 
+inline void AliFemtoManager::SetShareParticleCuts(bool share){fShareParticleCuts = share;}
+inline bool AliFemtoManager::ShareParticleCuts() const {return fShareParticleCuts;}
+
+inline int AliFemtoManager::NumberOfThreads() const {return fNThreads;}
+
 #endif
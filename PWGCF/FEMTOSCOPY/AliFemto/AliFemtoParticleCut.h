@@ -38,6 +38,13 @@ public:
 
   virtual AliFemtoParticleCut* Clone() { return NULL; }
 
+  /// String identifying the selection, used to share the per event
+  /// decisions between the analyses of a manager (see
+  /// AliFemtoParticleCutCache). Cuts of the same class returning the same
+  /// non-empty key must accept exactly the same particles. The default,
+  /// empty, key only shares the decisions of the same cut object.
+  virtual AliFemtoString SelectionKey() { return ""; }
+
   virtual AliFemtoParticleType Type() = 0;    ///< Pure virtual function which returns the particle type
 
   /// The following allows "back-pointing" from the CorrFctn to the "parent" Analysis
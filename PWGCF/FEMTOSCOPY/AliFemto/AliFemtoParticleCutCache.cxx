@@ -0,0 +1,82 @@
+///
+/// \file AliFemtoParticleCutCache.cxx
+///
+
+#include "AliFemtoParticleCutCache.h"
+
+#include <typeinfo>
+
+#ifdef __ROOT__
+  /// \cond CLASSIMP
+  ClassImp(AliFemtoParticleCutCache);
+  /// \endcond
+#endif
+
+//____________________________
+AliFemtoParticleCutCache::AliFemtoParticleCutCache():
+  fSlotOfCut(),
+  fSlotOfKey(),
+  fDecisions(),
+  fSlotEvent(),
+  fEvent(1)
+{
+  // default constructor
+}
+//____________________________
+AliFemtoParticleCutCache::~AliFemtoParticleCutCache()
+{
+  // destructor
+}
+//____________________________
+void AliFemtoParticleCutCache::NewEvent()
+{
+  // slots evaluated for an older event are out of date
+  fEvent++;
+}
+//____________________________
+int AliFemtoParticleCutCache::Slot(AliFemtoParticleCut *cut)
+{
+  // find the selection of the cut, the key is asked once per cut object
+  std::map<const AliFemtoParticleCut*, int>::const_iterator cutIter = fSlotOfCut.find(cut);
+  if (cutIter != fSlotOfCut.end()) {
+    return cutIter->second;
+  }
+
+  int slot = fDecisions.size();
+
+  const AliFemtoString key = cut->SelectionKey();
+  if (!key.empty()) {
+    // the class and the collection are part of the selection
+    std::string fullKey = typeid(*cut).name();
+    fullKey += "/";
+    fullKey += char('0' + cut->Type());
+    fullKey += "/";
+    fullKey += key;
+
+    std::map<std::string, int>::const_iterator keyIter = fSlotOfKey.find(fullKey);
+    if (keyIter != fSlotOfKey.end()) {
+      slot = keyIter->second;
+    } else {
+      fSlotOfKey[fullKey] = slot;
+    }
+  }
+
+  if (slot == (int) fDecisions.size()) {
+    fDecisions.push_back(std::vector<char>());
+    fSlotEvent.push_back(0);
+  }
+
+  fSlotOfCut[cut] = slot;
+  return slot;
+}
+//____________________________
+std::vector<char>& AliFemtoParticleCutCache::Decisions(AliFemtoParticleCut *cut, bool &evaluated)
+{
+  // decisions of the selection of the cut for the current event
+  const int slot = Slot(cut);
+
+  evaluated = (fSlotEvent[slot] == fEvent);
+  fSlotEvent[slot] = fEvent;
+
+  return fDecisions[slot];
+}
@@ -0,0 +1,70 @@
+///
+/// \file AliFemtoParticleCutCache.h
+///
+
+#ifndef ALIFEMTOPARTICLECUTCACHE_H
+#define ALIFEMTOPARTICLECUTCACHE_H
+
+#include "AliFemtoParticleCut.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/// \class AliFemtoParticleCutCache
+/// \brief Per event decisions of particle cuts, shared by the analyses of a manager
+///
+/// The AliFemtoManager hands the same event to all its analyses, and each
+/// analysis applies its particle cuts to the same track (V0, Xi, kink)
+/// collection. When several analyses use the same cut object, or cuts which
+/// are declared equivalent, the cut is evaluated only for the first analysis
+/// and the decisions are reused by the others.
+///
+/// Two different cut objects are equivalent if they are of the same class
+/// and their AliFemtoParticleCut::SelectionKey() is the same non-empty
+/// string. The decisions are stored per equivalence class, one entry per
+/// element of the event collection, and forgotten at each NewEvent().
+///
+/// Each analysis still builds its own AliFemtoParticle's (with the mass of
+/// its own cut) and fills the monitors of its own cut with the decisions,
+/// so that the outputs are the same as without the cache.
+///
+class AliFemtoParticleCutCache {
+public:
+  AliFemtoParticleCutCache();
+  virtual ~AliFemtoParticleCutCache();
+
+  /// Forget the decisions of the previous event
+  void NewEvent();
+
+  /// Decisions of the cut for the current event
+  ///
+  /// \param cut The particle cut
+  /// \param evaluated Set to true if the decisions were already evaluated
+  ///                  for this event, otherwise the caller must fill them
+  ///                  (the slot is then considered evaluated)
+  std::vector<char>& Decisions(AliFemtoParticleCut *cut, bool &evaluated);
+
+  /// Number of distinct selections seen so far
+  int GetNSelections() const { return fDecisions.size(); }
+
+private:
+  AliFemtoParticleCutCache(const AliFemtoParticleCutCache &);
+  AliFemtoParticleCutCache& operator=(const AliFemtoParticleCutCache &);
+
+  int Slot(AliFemtoParticleCut *cut);
+
+  std::map<const AliFemtoParticleCut*, int> fSlotOfCut; ///< selection of each cut object
+  std::map<std::string, int> fSlotOfKey;                ///< selection of each non-empty key
+  std::vector< std::vector<char> > fDecisions;          ///< decisions of each selection
+  std::vector<unsigned long> fSlotEvent;                ///< event for which the decisions were evaluated
+  unsigned long fEvent;                                 ///< current event counter
+
+#ifdef __ROOT__
+  /// \cond CLASSIMP
+  ClassDef(AliFemtoParticleCutCache, 0);
+  /// \endcond
+#endif
+};
+
+#endif
@@ -9,6 +9,7 @@
 #include "AliFemtoXiCut.h"
 #include "AliFemtoXiTrackCut.h"
 #include "AliFemtoPicoEvent.h"
+#include "AliFemtoParticleCutCache.h"
 
 #include <string>
 #include <iostream>
@@ -45,18 +46,40 @@ AliFemtoCorrFctn*    copyTheCorrFctn(AliFemtoCorrFctn*);
 /// other type, it is recommended to add TrackCollectionIterType to the
 /// template list, and add the appropriate type to the function calls in
 /// FillParticleCollection.
+///
+/// If a cut cache is given, the decisions of an equivalent cut already
+/// evaluated on this event are used instead of calling Pass, otherwise
+/// the decisions are stored for the next analyses.
 template <class TrackCollectionType, class TrackCutType>
 void DoFillParticleCollection(TrackCutType *cut,
                               TrackCollectionType *track_collection,
-                              AliFemtoParticleCollection *output)
+                              AliFemtoParticleCollection *output,
+                              AliFemtoParticleCutCache *cut_cache=NULL)
 {
   // lets's just name the iterator type
   typedef typename TrackCollectionType::iterator TrackCollectionIterType;
 
+  bool evaluated = false;
+  std::vector<char> *decisions = NULL;
+  if (cut_cache) {
+    decisions = &cut_cache->Decisions(cut, evaluated);
+    if (!evaluated) {
+      decisions->clear();
+    } else if (decisions->size() != track_collection->size()) {
+      // should not happen, the collection is the one of the same event
+      evaluated = false;
+      decisions->clear();
+    }
+  }
+
+  size_t index = 0;
   for (TrackCollectionIterType pIter = track_collection->begin();
                                pIter != track_collection->end();
-                               pIter++) {
-    const Bool_t track_passes = cut->Pass(*pIter);
+                               pIter++, index++) {
+    const Bool_t track_passes = evaluated ? (*decisions)[index] : cut->Pass(*pIter);
+    if (decisions && !evaluated) {
+      decisions->push_back(track_passes);
+    }
     cut->FillCutMonitor(*pIter, track_passes);
     if (track_passes) {
       output->push_back(new AliFemtoParticle(*pIter, cut->Mass()));
@@ -73,10 +96,11 @@ void DoFillParticleCollection(TrackCutType *cut,
 void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
                                AliFemtoEvent *hbtEvent,
                                AliFemtoParticleCollection *partCollection,
-                               bool performSharedDaughterCut=kFALSE)
+                               bool performSharedDaughterCut,
+                               AliFemtoParticleCutCache *cutCache)
 {
   /// Fill particle collection with all particles in the event which pass
-  /// the provided cut
+  /// the provided cut, sharing the decisions through cutCache if not NULL
 
   // determine which track collection to use based on the particle type.
   switch (partCut->Type()) {
@@ -87,7 +111,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
     DoFillParticleCollection(
       (AliFemtoTrackCut*)partCut,
       hbtEvent->TrackCollection(),
-      partCollection
+      partCollection,
+      cutCache
     );
 
     break;
@@ -109,7 +134,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
       DoFillParticleCollection(
         v0_cut,
         hbtEvent->V0Collection(),
-        partCollection
+        partCollection,
+        cutCache
       );
 
     }
@@ -123,7 +149,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
     DoFillParticleCollection(
       (AliFemtoXiTrackCut*)partCut,
       hbtEvent->XiCollection(),
-      partCollection
+      partCollection,
+      cutCache
     );
 
     break;
@@ -134,7 +161,8 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
     DoFillParticleCollection(
       (AliFemtoKinkCut*)partCut,
       hbtEvent->KinkCollection(),
-      partCollection
+      partCollection,
+      cutCache
     );
 
     break;
@@ -146,6 +174,15 @@ void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
 
   partCut->FillCutMonitor(hbtEvent, partCollection);
 }
+
+void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
+                               AliFemtoEvent *hbtEvent,
+                               AliFemtoParticleCollection *partCollection,
+                               bool performSharedDaughterCut=kFALSE)
+{
+  /// Fill particle collection, without sharing the cut decisions
+  FillHbtParticleCollection(partCut, hbtEvent, partCollection, performSharedDaughterCut, NULL);
+}
 //____________________________
 AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fPicoEventCollectionVectorHideAway(NULL),
@@ -161,7 +198,8 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fParticleCutCache(NULL)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -183,7 +221,8 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fParticleCutCache(NULL)
 {
   /// Copy constructor
 
@@ -470,14 +509,16 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   FillHbtParticleCollection(fFirstParticleCut,
                             (AliFemtoEvent*)hbtEvent,
                             fPicoEvent->FirstParticleCollection(),
-                            fPerformSharedDaughterCut);
+                            fPerformSharedDaughterCut,
+                            fParticleCutCache);
 
   // fill second particle cut if not analyzing identical particles
   if ( !AnalyzeIdenticalParticles() ) {
       FillHbtParticleCollection(fSecondParticleCut,
                                 (AliFemtoEvent*)hbtEvent,
                                 fPicoEvent->SecondParticleCollection(),
-                                fPerformSharedDaughterCut);
+                                fPerformSharedDaughterCut,
+                                fParticleCutCache);
   }
 
   const UInt_t coll_1_size = collection1->size(),
@@ -17,6 +17,7 @@
 
 class AliFemtoPicoEventCollectionVectorHideAway;
 class AliFemtoPicoEvent;
+class AliFemtoParticleCutCache;
 
 ///
 /// \class AliFemtoSimpleAnalysis
@@ -98,6 +99,10 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Share the particle cut decisions with the other analyses using the
+  /// cache (set by the AliFemtoManager, not owned)
+  void SetParticleCutCache(AliFemtoParticleCutCache* aCache);
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -177,6 +182,8 @@ protected:
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
 
+  AliFemtoParticleCutCache*    fParticleCutCache;    //!<! Particle cut decisions shared with the other analyses, not owned
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassDef(AliFemtoSimpleAnalysis, 0);
@@ -304,4 +311,9 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetParticleCutCache(AliFemtoParticleCutCache* aCache)
+{
+  fParticleCutCache = aCache;
+}
+
 #endif
@@ -38,6 +38,7 @@
 #pragma link C++ class AliFemtoCutMonitorHandler+;
 #pragma link C++ class AliFemtoLorentzVector+;
 #pragma link C++ class AliFemtoManager+;
+#pragma link C++ class AliFemtoParticleCutCache+;
 #pragma link C++ class AliFmHelixD+;
 #pragma link C++ class AliFmLorentzVectorD+;
 #pragma link C++ class AliFmPhysicalHelixD+;
@@ -46,6 +46,7 @@
 
 #include "AliFemtoESDTrackCut.h"
 #include <cstdio>
+#include <typeinfo>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -602,6 +603,36 @@ TList *AliFemtoESDTrackCut::ListSettings()
   }
   return tListSetttings;
 }
+
+AliFemtoString AliFemtoESDTrackCut::SelectionKey()
+{
+  // all the parameters used in Pass(), classes deriving from this one
+  // may cut on more and do not share their decisions
+  if (typeid(*this) != typeid(AliFemtoESDTrackCut)) {
+    return "";
+  }
+
+  TString key = TString::Format("%.9g;%d;%.9g,%.9g;%.9g,%.9g;%.9g,%.9g;",
+                                Mass(), fCharge, fPt[0], fPt[1], fRapidity[0], fRapidity[1], fEta[0], fEta[1]);
+  key += TString::Format("%.9g,%.9g;%.9g,%.9g;%.9g,%.9g;%.9g,%.9g;%.9g,%.9g;",
+                         fPidProbElectron[0], fPidProbElectron[1], fPidProbPion[0], fPidProbPion[1],
+                         fPidProbKaon[0], fPidProbKaon[1], fPidProbProton[0], fPidProbProton[1],
+                         fPidProbMuon[0], fPidProbMuon[1]);
+  key += TString::Format("%d,%d,%d;%d;%ld;%d;%d;%d;%.17g;",
+                         fCutClusterRequirementITS[0], fCutClusterRequirementITS[1], fCutClusterRequirementITS[2],
+                         fLabel, fStatus, fPIDMethod, fNsigmaTPCTOF, fNsigmaTPConly, fNsigma);
+  key += TString::Format("%d;%d;%d;%.9g;%.9g;%.9g;%d;%d;%d;",
+                         fminTPCclsF, fminTPCncls, fminITScls, fMaxITSchiNdof, fMaxTPCchiNdof, fMaxSigmaToVertex,
+                         fRemoveKinks, fRemoveITSFake, fMostProbable);
+  key += TString::Format("%.9g;%.9g;%.9g;%.9g,%.9g,%.9g;",
+                         fMaxImpactXY, fMinImpactXY, fMaxImpactZ, fMaxImpactXYPtOff, fMaxImpactXYPtNrm, fMaxImpactXYPtPow);
+  key += TString::Format("%.9g,%.9g;%.9g,%.9g;%.9g,%.9g;%d",
+                         fMinPforTOFpid, fMaxPforTOFpid, fMinPforTPCpid, fMaxPforTPCpid, fMinPforITSpid, fMaxPforITSpid,
+                         fElectronRejection);
+
+  return key.Data();
+}
+
 void AliFemtoESDTrackCut::SetRemoveKinks(const bool& flag)
 {
   fRemoveKinks = flag;
@@ -26,6 +26,7 @@ public:
 
   virtual AliFemtoString Report();
   virtual TList *ListSettings();
+  virtual AliFemtoString SelectionKey();
   virtual AliFemtoParticleType Type(){return hbtTrack;}
 
   void SetPt(const float& lo, const float& hi);
@@ -9,8 +9,15 @@
 ClassImp(AliBlastwaveFit2D);
 
 
-TF2 *AliBlastwaveFit2D::fgFuncIntYield = NULL;
-TF2 *AliBlastwaveFit2D::fgFuncIntV2 = NULL;
+Bool_t AliBlastwaveFit2D::fgQuadInitialized = kFALSE;
+Double_t AliBlastwaveFit2D::fgQuadCos2Phi[AliBlastwaveFit2D::fgkNquadPhi];
+Double_t AliBlastwaveFit2D::fgQuadWPhi[AliBlastwaveFit2D::fgkNquadPhi];
+Double_t AliBlastwaveFit2D::fgQuadR[AliBlastwaveFit2D::fgkNquadR];
+Double_t AliBlastwaveFit2D::fgQuadWR[AliBlastwaveFit2D::fgkNquadR];
+Double_t AliBlastwaveFit2D::fgKernelPar[4] = {-1,-1,-1,-1};
+Double_t AliBlastwaveFit2D::fgKernelSinh[AliBlastwaveFit2D::fgkNquadPhi*AliBlastwaveFit2D::fgkNquadR];
+Double_t AliBlastwaveFit2D::fgKernelCosh[AliBlastwaveFit2D::fgkNquadPhi*AliBlastwaveFit2D::fgkNquadR];
+Double_t AliBlastwaveFit2D::fgKernelWeight[AliBlastwaveFit2D::fgkNquadPhi*AliBlastwaveFit2D::fgkNquadR];
 const char *AliBlastwaveFit2D::fgParName[7] = {"T_{FO}","s_{2}","mean #rho_{0}","#rho_{2}","#gamma","mass","norm"};
 Float_t AliBlastwaveFit2D::fgStartValues[5] = {0.1,0.057,1.2,0.025,1.1};
 const Float_t AliBlastwaveFit2D::fgStepValues[5] = {0.001,0.001,0.001,0.001,0.001};
@@ -20,16 +27,7 @@ const Float_t AliBlastwaveFit2D::fgMaxValues[5] = {1.0,0.45,10.0,0.45,5};
 AliBlastwaveFit2D::AliBlastwaveFit2D(const char *name,Double_t mass) :
   AliBlastwaveFit(name,mass)
 {
-  if(!fgFuncIntYield){
-     fgFuncIntYield = new TF2("fFuncInt2Yield",AliBlastwaveFit2D::FunctionIntYield,0,2*TMath::Pi(),0,1,7);
-     fgFuncIntYield->SetNpx(100);
-     fgFuncIntYield->SetNpy(100);
-  }
-  if(!fgFuncIntV2){
-     fgFuncIntV2 = new TF2("fFuncInt2V2",AliBlastwaveFit2D::FunctionIntV2,0,2*TMath::Pi(),0,1,7);
-     fgFuncIntV2->SetNpx(100);
-     fgFuncIntV2->SetNpy(100);
-  }
+  InitQuadrature();
 
   Initialize();
 }
@@ -37,16 +35,7 @@ AliBlastwaveFit2D::AliBlastwaveFit2D(const char *name,Double_t mass) :
 AliBlastwaveFit2D::AliBlastwaveFit2D() :
   AliBlastwaveFit()
 {  
-  if(!fgFuncIntYield){
-     fgFuncIntYield = new TF2("fFuncInt2Yield",AliBlastwaveFit2D::FunctionIntYield,0,2*TMath::Pi(),0,1,7);
-     fgFuncIntYield->SetNpx(100);
-     fgFuncIntYield->SetNpy(100);
-  }
-  if(!fgFuncIntV2){
-     fgFuncIntV2 = new TF2("fFuncInt2V2",AliBlastwaveFit2D::FunctionIntV2,0,2*TMath::Pi(),0,1,7);
-     fgFuncIntV2->SetNpx(100);
-     fgFuncIntV2->SetNpy(100);
-  }
+  InitQuadrature();
   Initialize();
 }
 //------------------------------------------------------------------------------
@@ -174,24 +163,10 @@ Double_t AliBlastwaveFit2D::V2(Double_t x[],Double_t par[]){
   // par[5] = mass
   Double_t maxRho = par[2]*0.5*(par[4]+2)/(1+2*par[1]*par[3]);
 
-  fgFuncIntYield->SetParameter(0,x[0]);
-  fgFuncIntYield->SetParameter(1,par[0]);
-  fgFuncIntYield->SetParameter(2,par[1]);
-  fgFuncIntYield->SetParameter(3,maxRho);
-  fgFuncIntYield->SetParameter(4,par[3]*maxRho*2);
-  fgFuncIntYield->SetParameter(5,par[4]);
-  fgFuncIntYield->SetParameter(6,par[5]);
-
-  fgFuncIntV2->SetParameter(0,x[0]);
-  fgFuncIntV2->SetParameter(1,par[0]);
-  fgFuncIntV2->SetParameter(2,par[1]);
-  fgFuncIntV2->SetParameter(3,maxRho);
-  fgFuncIntV2->SetParameter(4,par[3]*maxRho*2);
-  fgFuncIntV2->SetParameter(5,par[4]);
-  fgFuncIntV2->SetParameter(6,par[5]);
-
-  Double_t res = fgFuncIntV2->Integral(0.,2*TMath::Pi(),0.,1.);
-  Double_t den = fgFuncIntYield->Integral(0.,2*TMath::Pi(),0.,1.);
+  SetKernel(maxRho,par[3]*maxRho*2,par[4],par[1]);
+
+  Double_t den,res;
+  IntegrateKernel(x[0],par[0],par[5],den,res);
   
   if(den == 0) return 0.0;
 
@@ -208,39 +183,19 @@ Double_t AliBlastwaveFit2D::Pt(Double_t x[],Double_t par[]){
 
   Double_t maxRho = par[2]*0.5*(par[4]+2)/(1+2*par[1]*par[3]);
 
-  fgFuncIntYield->SetParameter(0,x[0]);
-  fgFuncIntYield->SetParameter(1,par[0]);
-  fgFuncIntYield->SetParameter(2,par[1]);
-  fgFuncIntYield->SetParameter(3,maxRho);
-  fgFuncIntYield->SetParameter(4,par[3]*maxRho*2);
-  fgFuncIntYield->SetParameter(5,par[4]);
-  fgFuncIntYield->SetParameter(6,par[5]);
+  SetKernel(maxRho,par[3]*maxRho*2,par[4],par[1]);
 
-  fgFuncIntV2->SetParameter(0,x[0]);
-  fgFuncIntV2->SetParameter(1,par[0]);
-  fgFuncIntV2->SetParameter(2,par[1]);
-  fgFuncIntV2->SetParameter(3,maxRho);
-  fgFuncIntV2->SetParameter(4,par[3]*maxRho*2);
-  fgFuncIntV2->SetParameter(5,par[4]);
-  fgFuncIntV2->SetParameter(6,par[5]);
+  Double_t yield,v2num;
+  IntegrateKernel(x[0],par[0],par[5],yield,v2num);
 
-  Double_t res = par[6]*1E+5*fgFuncIntYield->Integral(0.,2*TMath::Pi(),0.,1.);
+  Double_t res = par[6]*1E+5*yield;
 
   return res;
 }
 //------------------------------------------------------------------------------
 Float_t AliBlastwaveFit2D::GetMeanBeta(){
-
-  TF2 fbeta("fbeta","TMath::TanH(([0]+[1]*TMath::Cos(2*x))*TMath::Power(y,[2]))*y*(1+2*[3]*cos(2*x))",0,2*TMath::Pi(),0,1);
-  fbeta.SetNpx(1000);
-  fbeta.SetNpy(1000);
-
-  fbeta.SetParameter(0,fgFuncIntYield->GetParameter(3));
-  fbeta.SetParameter(1,fgFuncIntYield->GetParameter(4));
-  fbeta.SetParameter(2,fgFuncIntYield->GetParameter(5));
-  fbeta.SetParameter(3,fgFuncIntYield->GetParameter(2));
-
-  return fbeta.Integral(0.,2*TMath::Pi(),0.,1.)/TMath::Pi();
+  // mean beta for the last parameters used in the evaluation of the functions
+  return IntegrateMeanBeta();
 }
 //------------------------------------------------------------------------------
 Float_t AliBlastwaveFit2D::GetMeanBeta(Double_t par[]){
@@ -253,16 +208,119 @@ Float_t AliBlastwaveFit2D::GetMeanBeta(Double_t par[]){
 
   Double_t maxRho = par[2]*0.5*(par[4]+2)/(1+2*par[1]*par[3]);
 
-  TF2 fbeta("fbeta","TMath::TanH(([0]+[1]*TMath::Cos(2*x))*TMath::Power(y,[2]))*y*(1+2*[3]*cos(2*x))",0,2*TMath::Pi(),0,1);
-  fbeta.SetNpx(1000);
-  fbeta.SetNpy(1000);
+  SetKernel(maxRho,2*par[3]*maxRho,par[4],par[1]);
+
+  return IntegrateMeanBeta();
+}
+//------------------------------------------------------------------------------
+void AliBlastwaveFit2D::InitQuadrature(){
+  // Gauss-Legendre nodes and weights in phi and r/R.
+  // The integrands depend on phi only through cos(2 phi), so that the
+  // integral on [0,2pi] is 4 times the one on [0,pi/2]
+  if(fgQuadInitialized) return;
+
+  const Int_t nquad[2] = {fgkNquadPhi,fgkNquadR};
+  const Double_t xmax[2] = {TMath::PiOver2(),1.};
+  Double_t *xnode[2] = {fgQuadCos2Phi,fgQuadR};
+  Double_t *wnode[2] = {fgQuadWPhi,fgQuadWR};
+
+  for(Int_t k=0;k < 2;k++){
+    Int_t n = nquad[k];
+    for(Int_t i=0;i < (n+1)/2;i++){
+      // Newton iterations on the Legendre polynomial P_n starting from the Chebyshev approximation
+      Double_t z = TMath::Cos(TMath::Pi()*(i+0.75)/(n+0.5));
+      Double_t dp = 0;
+      for(Int_t iter=0;iter < 100;iter++){
+	Double_t p1 = 1,p2 = 0;
+	for(Int_t j=1;j <= n;j++){
+	  Double_t p3 = p2;
+	  p2 = p1;
+	  p1 = ((2*j-1)*z*p2-(j-1)*p3)/j;
+	}
+	dp = n*(z*p1-p2)/(z*z-1);
+	Double_t z1 = z;
+	z = z1-p1/dp;
+	if(TMath::Abs(z-z1) < 1E-15) break;
+      }
+      Double_t w = 2/((1-z*z)*dp*dp);
+      // map [-1,1] on [0,xmax]
+      xnode[k][i] = 0.5*xmax[k]*(1-z);
+      xnode[k][n-1-i] = 0.5*xmax[k]*(1+z);
+      wnode[k][i] = wnode[k][n-1-i] = 0.5*xmax[k]*w;
+    }
+  }
+
+  for(Int_t i=0;i < fgkNquadPhi;i++){
+    fgQuadCos2Phi[i] = TMath::Cos(2*fgQuadCos2Phi[i]);
+    fgQuadWPhi[i] *= 4;
+  }
 
-  fbeta.SetParameter(0,maxRho);
-  fbeta.SetParameter(1,2*par[3]*maxRho);
-  fbeta.SetParameter(2,par[4]);
-  fbeta.SetParameter(3,par[1]);
+  fgQuadInitialized = kTRUE;
+}
+//------------------------------------------------------------------------------
+void AliBlastwaveFit2D::SetKernel(Double_t rho0,Double_t rhoa,Double_t gamma,Double_t s2){
+  // rho0 = rho_0, rhoa = rho_a, gamma = R_power (as par[3],par[4],par[5] of FunctionIntYield)
+  // the parameter dependent part of the integrand not depending on pt is
+  // computed once per parameter set
+  if(rho0 == fgKernelPar[0] && rhoa == fgKernelPar[1] && gamma == fgKernelPar[2] && s2 == fgKernelPar[3]) return;
+
+  InitQuadrature();
+
+  for(Int_t ir=0;ir < fgkNquadR;ir++){
+    Double_t rpow = TMath::Power(fgQuadR[ir],gamma);
+    for(Int_t iphi=0;iphi < fgkNquadPhi;iphi++){
+      Int_t k = ir*fgkNquadPhi + iphi;
+      Double_t rho = (rho0+rhoa*fgQuadCos2Phi[iphi])*rpow;
+      fgKernelSinh[k] = TMath::SinH(rho);
+      fgKernelCosh[k] = TMath::CosH(rho);
+      fgKernelWeight[k] = fgQuadWR[ir]*fgQuadWPhi[iphi]*fgQuadR[ir]*(1+2*s2*fgQuadCos2Phi[iphi]);
+    }
+  }
+
+  fgKernelPar[0] = rho0;
+  fgKernelPar[1] = rhoa;
+  fgKernelPar[2] = gamma;
+  fgKernelPar[3] = s2;
+}
+//------------------------------------------------------------------------------
+void AliBlastwaveFit2D::IntegrateKernel(Double_t pt,Double_t t,Double_t mass,Double_t &yield,Double_t &v2num){
+  // integrals on (phi,r) of FunctionIntYield (yield) and FunctionIntV2 (v2num)
+  // for the current kernel, computed together since they share the Bessel K1
+  Double_t mt = TMath::Sqrt(pt*pt+mass*mass);
+
+  yield = 0;
+  v2num = 0;
+  for(Int_t ir=0;ir < fgkNquadR;ir++){
+    for(Int_t iphi=0;iphi < fgkNquadPhi;iphi++){
+      Int_t k = ir*fgkNquadPhi + iphi;
+      Double_t alfat = (pt/t)*fgKernelSinh[k];
+      Double_t betat = (mt/t)*fgKernelCosh[k];
+      Double_t i0k1,i2k1;
+      if(betat < 200){
+	Double_t k1 = TMath::BesselK1(betat);
+	Double_t i0 = TMath::BesselI0(alfat);
+	Double_t i2;
+	if(TMath::Abs(alfat) > 1E-2) i2 = i0 - 2*TMath::BesselI1(alfat)/alfat;
+	else i2 = alfat*alfat*(1+alfat*alfat/12)/8; // series to avoid the cancellation
+	i0k1 = i0*k1;
+	i2k1 = i2*k1;
+      }
+      else i0k1 = i2k1 = 0.5*TMath::Exp(alfat-betat)/sqrt(alfat*betat);
+
+      yield += fgKernelWeight[k]*i0k1;
+      v2num += fgKernelWeight[k]*fgQuadCos2Phi[iphi]*i2k1;
+    }
+  }
+  yield *= pt*mt;
+  v2num *= pt*mt;
+}
+//------------------------------------------------------------------------------
+Double_t AliBlastwaveFit2D::IntegrateMeanBeta(){
+  // integral on (phi,r) of tanh(rho)*r*(1+2 s2 cos(2 phi)), divided by pi
+  Double_t res = 0;
+  for(Int_t k=0;k < fgkNquadPhi*fgkNquadR;k++) res += fgKernelWeight[k]*fgKernelSinh[k]/fgKernelCosh[k];
 
-  return fbeta.Integral(0.,2*TMath::Pi(),0.,1.)/TMath::Pi();
+  return res/TMath::Pi();
 }
 //------------------------------------------------------------------------------
 void AliBlastwaveFit2D::SwitchOffFlow(TMinuit *m) const{
@@ -71,8 +71,25 @@ class AliBlastwaveFit2D : public AliBlastwaveFit
   AliBlastwaveFit2D& operator=(const AliBlastwaveFit2D &/*source*/); // ass. op.
 
 
-  static TF2 *fgFuncIntYield; // function used to integrate FunctionIntYield
-  static TF2 *fgFuncIntV2; // function used to integrate FunctionIntV2
+  // fixed Gauss-Legendre quadrature on (phi,r) used instead of TF2::Integral
+  static void InitQuadrature();
+  static void SetKernel(Double_t rho0,Double_t rhoa,Double_t gamma,Double_t s2); // prepare the (phi,r) grid
+  static void IntegrateKernel(Double_t pt,Double_t t,Double_t mass,Double_t &yield,Double_t &v2num); // integrals at pt
+  static Double_t IntegrateMeanBeta();
+
+  static const Int_t fgkNquadPhi = 40; // quadrature nodes in phi (on [0,pi/2], by symmetry)
+  static const Int_t fgkNquadR = 40;   // quadrature nodes in r/R
+  static Bool_t fgQuadInitialized;            // quadrature nodes computed
+  static Double_t fgQuadCos2Phi[fgkNquadPhi]; // cos(2 phi) at the phi nodes
+  static Double_t fgQuadWPhi[fgkNquadPhi];    // phi weights (times 4 for the full [0,2pi] range)
+  static Double_t fgQuadR[fgkNquadR];         // r/R nodes
+  static Double_t fgQuadWR[fgkNquadR];        // r/R weights
+
+  // kernel of the last parameter set (rho0,rhoa,gamma,s2), shared by all the pt points
+  static Double_t fgKernelPar[4];                          // parameters of the current kernel
+  static Double_t fgKernelSinh[fgkNquadPhi*fgkNquadR];     // sinh(rho) at the nodes
+  static Double_t fgKernelCosh[fgkNquadPhi*fgkNquadR];     // cosh(rho) at the nodes
+  static Double_t fgKernelWeight[fgkNquadPhi*fgkNquadR];   // weight*r*(1+2 s2 cos(2 phi)) at the nodes
 
   ClassDef(AliBlastwaveFit2D,1)  // blast wave fit 2D
 };
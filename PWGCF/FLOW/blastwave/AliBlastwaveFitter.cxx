@@ -300,10 +300,11 @@ void AliBlastwaveFitter::FCN(Int_t &npar, Double_t *gin, Double_t &f, Double_t *
 		    pt = gForFit->GetX()[ibin];
 		    if(pt < fgFuncC[i]->GetMaxPt() && pt > fgFuncC[i]->GetMinPt()){
 			val = gForFit->GetY()[ibin];
-			if(val - fgFuncC[i]->EvalV2(pt) > 0) vale = gForFit->GetEYlow()[ibin];
+			Double_t v2fit = fgFuncC[i]->EvalV2(pt);
+			if(val - v2fit > 0) vale = gForFit->GetEYlow()[ibin];
 			else vale = gForFit->GetEYhigh()[ibin];
 			if(vale>0){
-			  pull = (val - fgFuncC[i]->EvalV2(pt))/vale;
+			  pull = (val - v2fit)/vale;
 			  chi += pull * pull;
 			  fgNDGF++;
 			}
@@ -48,7 +48,14 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillPlansCompiled(kFALSE),
+  fPlanHistograms(),
+  fPlanClassFirst(),
+  fPlanType(),
+  fPlanVarW(),
+  fPlanVarFirst(),
+  fPlanVars()
 {
   //
   // Constructor
@@ -70,7 +77,14 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillPlansCompiled(kFALSE),
+  fPlanHistograms(),
+  fPlanClassFirst(),
+  fPlanType(),
+  fPlanVarW(),
+  fPlanVarFirst(),
+  fPlanVars()
 {
   //
   // Constructor
@@ -130,6 +144,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
   fMainList.Add(hList);
+  fFillPlansCompiled = kFALSE;
 }
 
 //_________________________________________________________________
@@ -180,6 +195,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
       if(xLabels[0]!='\0') MakeAxisLabels(h->GetXaxis(), xLabels);
       fUsedVars[varX] = kTRUE;
       hList->Add(h);
+      fFillPlansCompiled = kFALSE;
       h->SetDirectory(0);
       break;
     case 2:
@@ -214,6 +230,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
       fUsedVars[varX] = kTRUE;
       fUsedVars[varY] = kTRUE;
       hList->Add(h);
+      fFillPlansCompiled = kFALSE;
       h->SetDirectory(0);
       break;
     case 3:
@@ -264,6 +281,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
       fUsedVars[varZ] = kTRUE;
       h->SetDirectory(0);
       hList->Add(h);
+      fFillPlansCompiled = kFALSE;
       break;
   }
 }
@@ -318,6 +336,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
       fUsedVars[varX] = kTRUE;
       h->SetDirectory(0);
       hList->Add(h);
+      fFillPlansCompiled = kFALSE;
       break;
     case 2:
       if(isProfile) {
@@ -353,6 +372,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
       fUsedVars[varY] = kTRUE;
       h->SetDirectory(0);
       hList->Add(h);
+      fFillPlansCompiled = kFALSE;
       break;
     case 3:
       if(isProfile) {
@@ -402,6 +422,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
       fUsedVars[varY] = kTRUE;
       fUsedVars[varZ] = kTRUE;
       hList->Add(h);
+      fFillPlansCompiled = kFALSE;
       break;
   }
 }
@@ -452,6 +473,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     fUsedVars[vars[idim]] = kTRUE;
   }
   hList->Add(h);
+  fFillPlansCompiled = kFALSE;
   fBinsAllocated+=bins;
 }
 
@@ -515,6 +537,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     fUsedVars[vars[idim]] = kTRUE;
   }
   hList->Add(h);
+  fFillPlansCompiled = kFALSE;
   fBinsAllocated+=bins;
 }
 
@@ -599,139 +622,182 @@ THnF* AliHistogramManager::CreateHistogram( const Char_t* name, const Char_t* ti
 
 
 //__________________________________________________________________
-void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+void AliHistogramManager::CompileFillPlans() {
   //
-  //  fill a class of histograms
+  //  Decode the fill information of all histograms (fill type, variables and weight, encoded in the
+  //  UniqueID of the histograms and of their axes) into flat per class fill plans.
+  //  The position of each class in the plans is stored as the UniqueID of its histogram list.
   //
-  THashList* hList = (THashList*)fMainList.FindObject(className);
-  if(!hList) {
-    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
-    cout << "         Histogram list not filled" << endl; */
-    return;
-  }
-  if(!hList) {
-    return;
-  }
+  Int_t nClasses = fMainList.GetEntries();
+  Int_t nHists = 0;
+  for(Int_t icl=0; icl<nClasses; ++icl) nHists += ((THashList*)fMainList.At(icl))->GetEntries();
+  
+  fPlanHistograms.Clear();
+  fPlanHistograms.Expand(nHists>0 ? nHists : 1);
+  fPlanClassFirst.Set(nClasses+1);
+  fPlanType.Set(nHists);
+  fPlanVarW.Set(nHists);
+  fPlanVarFirst.Set(nHists+1);
+  fPlanVars.Set(4*nHists);
+  
+  Int_t nEntries = 0;
+  Int_t nVars = 0;
+  Int_t vars[20];
+  TIter nextClass(&fMainList);
+  THashList* hList=0x0;
+  for(Int_t icl=0; (hList=(THashList*)nextClass()); ++icl) {
+    hList->SetUniqueID(icl);
+    fPlanClassFirst[icl] = nEntries;
     
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
-    }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
+    TIter next(hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      Int_t uid = h->GetUniqueID();
+      Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+      Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);
+      Int_t thnDim = 0;
+      if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
+      Int_t dimension = 0;
+      if(!isTHn) dimension = ((TH1*)h)->GetDimension();
+      
+      uid = (uid-(uid%100))/100;
+      Int_t varT = -1;
+      Int_t varW = -1;
+      if(uid>0) {
+        varW = uid%(fNVars+1)-1;
+        if(varW==0) varW=AliReducedVarManager::kNothing;
+        uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+        if(uid>0) varT = uid - 1;
+      }
+      
+      Int_t type = -1;
+      Int_t nv = 0;
+      if(!isTHn) {
+        vars[nv++] = ((TH1*)h)->GetXaxis()->GetUniqueID();
         switch(dimension) {
           case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
+            type = (isProfile ? kFillProfile : kFillTH1);
+            if(isProfile) vars[nv++] = ((TH1*)h)->GetYaxis()->GetUniqueID();
           break;
           case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
+            type = (isProfile ? kFillProfile2D : kFillTH2);
+            vars[nv++] = ((TH1*)h)->GetYaxis()->GetUniqueID();
+            if(isProfile) vars[nv++] = ((TH1*)h)->GetZaxis()->GetUniqueID();
           break;
           case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
+            type = (isProfile ? kFillProfile3D : kFillTH3);
+            vars[nv++] = ((TH1*)h)->GetYaxis()->GetUniqueID();
+            vars[nv++] = ((TH1*)h)->GetZaxis()->GetUniqueID();
+            if(isProfile) vars[nv++] = varT;
           break;
           default:
           break;
-        }  // end switch
-      }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-        fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-      }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW])
-            ((THnF*)h)->Fill(fillValues,values[varW]);
         }
-        else
-          ((THnF*)h)->Fill(fillValues);
       }
+      else {
+        type = kFillTHn;
+        for(Int_t idim=0; idim<thnDim && idim<20; ++idim)
+          vars[nv++] = ((THnF*)h)->GetAxis(idim)->GetUniqueID();
+      }
+      if(type<0) continue;
+      
+      // histograms with variables not in use are never filled
+      Bool_t allVarsGood = kTRUE;
+      for(Int_t iv=0; iv<nv; ++iv)
+        if(vars[iv]<0 || vars[iv]>=AliReducedVarManager::kNVars || !fUsedVars[vars[iv]]) allVarsGood = kFALSE;
+      if(varW>AliReducedVarManager::kNothing && !fUsedVars[varW]) allVarsGood = kFALSE;
+      if(!allVarsGood) continue;
+      
+      if(fPlanVars.GetSize()<nVars+nv) fPlanVars.Set(2*(nVars+nv));
+      fPlanHistograms.AddAt(h, nEntries);
+      fPlanType[nEntries] = type;
+      fPlanVarW[nEntries] = (varW>AliReducedVarManager::kNothing ? varW : -1);
+      fPlanVarFirst[nEntries] = nVars;
+      for(Int_t iv=0; iv<nv; ++iv) fPlanVars[nVars++] = vars[iv];
+      ++nEntries;
+    }
+  }
+  fPlanClassFirst[nClasses] = nEntries;
+  fPlanVarFirst[nEntries] = nVars;
+  fFillPlansCompiled = kTRUE;
+}
+
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassIndex(const Char_t* className) {
+  //
+  //  Get the handle of a histogram class, to be used with FillHistClass(Int_t, Float_t*)
+  //  Handles stay valid when histograms or classes are added later
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) return -1;
+  if(!fFillPlansCompiled) CompileFillPlans();
+  return Int_t(hList->GetUniqueID());
+}
+
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+  //
+  //  fill a class of histograms
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) {
+    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
+    cout << "         Histogram list not filled" << endl; */
+    return;
+  }
+  if(!fFillPlansCompiled) CompileFillPlans();
+  FillHistClass(Int_t(hList->GetUniqueID()), values);
+}
+
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classIndex, Float_t* values) {
+  //
+  //  fill a class of histograms, using the precompiled fill plan
+  //
+  if(!fFillPlansCompiled) CompileFillPlans();
+  if(classIndex<0 || classIndex>=fPlanClassFirst.GetSize()-1) return;
+  
+  Double_t fillValues[20]={0.0};
+  const Int_t* vars = fPlanVars.GetArray();
+  for(Int_t ie=fPlanClassFirst[classIndex]; ie<fPlanClassFirst[classIndex+1]; ++ie) {
+    TObject* h = fPlanHistograms.UncheckedAt(ie);
+    const Int_t* v = vars + fPlanVarFirst[ie];
+    Int_t varW = fPlanVarW[ie];
+    switch(fPlanType[ie]) {
+      case kFillTH1:
+        if(varW>=0) ((TH1F*)h)->Fill(values[v[0]],values[varW]);
+        else ((TH1F*)h)->Fill(values[v[0]]);
+      break;
+      case kFillProfile:
+        if(varW>=0) ((TProfile*)h)->Fill(values[v[0]],values[v[1]],values[varW]);
+        else ((TProfile*)h)->Fill(values[v[0]],values[v[1]]);
+      break;
+      case kFillTH2:
+        if(varW>=0) ((TH2F*)h)->Fill(values[v[0]],values[v[1]],values[varW]);
+        else ((TH2F*)h)->Fill(values[v[0]],values[v[1]]);
+      break;
+      case kFillProfile2D:
+        if(varW>=0) ((TProfile2D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[varW]);
+        else ((TProfile2D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]]);
+      break;
+      case kFillTH3:
+        if(varW>=0) ((TH3F*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[varW]);
+        else ((TH3F*)h)->Fill(values[v[0]],values[v[1]],values[v[2]]);
+      break;
+      case kFillProfile3D:
+        if(varW>=0) ((TProfile3D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[v[3]],values[varW]);
+        else ((TProfile3D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[v[3]]);
+      break;
+      case kFillTHn:
+        for(Int_t idim=0; idim<fPlanVarFirst[ie+1]-fPlanVarFirst[ie]; ++idim) fillValues[idim] = values[v[idim]];
+        if(varW>=0) ((THnF*)h)->Fill(fillValues,values[varW]);
+        else ((THnF*)h)->Fill(fillValues);
+      break;
+      default:
+      break;
     }
   }
 }
@@ -13,12 +13,13 @@
 #include <THn.h>
 #include <TList.h>
 #include <THashList.h>
+#include <TObjArray.h>
+#include <TArrayI.h>
 
 #include "AliReducedVarManager.h"
 
 class TAxis;
 class TArrayD;
-class TObjArray;
 //class TDirectoryFile;
 class TFile;
 
@@ -65,6 +66,9 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(Int_t classIndex, Float_t* values);             // fill using a handle from GetHistClassIndex()
+  Int_t GetHistClassIndex(const Char_t* className);                 // handle of a histogram class, -1 if not existing
+  void CompileFillPlans();
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -101,9 +105,24 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Fill plans: for each histogram class, the list of histograms to be filled with their
+  // fill type and the indices of the variables, decoded once from the UniqueID's.
+  // Histograms using a variable which is not flagged in fUsedVars are not included.
+  // The plans are rebuilt automatically after any histogram or class is added.
+  enum FillType {
+    kFillTH1=0, kFillProfile, kFillTH2, kFillProfile2D, kFillTH3, kFillProfile3D, kFillTHn
+  };
+  Bool_t fFillPlansCompiled;             //! fill plans are up to date
+  TObjArray fPlanHistograms;             //! histograms of all classes, ordered by class (not owned)
+  TArrayI fPlanClassFirst;               //! first entry in the plan of each class (nclasses+1 values)
+  TArrayI fPlanType;                     //! fill type of each entry
+  TArrayI fPlanVarW;                     //! weight variable of each entry, -1 if not weighted
+  TArrayI fPlanVarFirst;                 //! first variable in fPlanVars of each entry (nentries+1 values)
+  TArrayI fPlanVars;                     //! variables to be filled, for all entries
+  
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
   
-  ClassDef(AliHistogramManager, 3)
+  ClassDef(AliHistogramManager, 4)
 };
 
 #endif
@@ -21,6 +21,7 @@ using std::flush;
 
 #include "AliReducedVarManager.h"
 #include "AliReducedBaseTrack.h"
+#include "AliMixingPool.h"
 
 ClassImp(AliMixingHandler);
 
@@ -31,8 +32,7 @@ AliMixingHandler::AliMixingHandler() :
   fMixingThreshold(1.0),
   fDownscaleEvents(1.0),
   fDownscaleTracks(1.0),
-  fPoolsLeg1("TClonesArray"),
-  fPoolsLeg2("TClonesArray"),
+  fPools(),
   fNParallelCuts(0),
   fHistClassNames(""),
   fPoolSize(),
@@ -66,8 +66,7 @@ AliMixingHandler::AliMixingHandler(const Char_t* name, const Char_t* title) :
   fMixingThreshold(1.0),
   fDownscaleEvents(1.0),
   fDownscaleTracks(1.0),
-  fPoolsLeg1("TClonesArray"),
-  fPoolsLeg2("TClonesArray"),
+  fPools(),
   fNParallelCuts(0),
   fHistClassNames(""),
   fPoolSize(),
@@ -139,8 +138,7 @@ void AliMixingHandler::Init() {
     return;
   }
   Int_t size = (fCentralityLimits.GetSize()-1)*(fEventVertexLimits.GetSize()-1)*(fEventPlaneLimits.GetSize()-1);
-  fPoolsLeg1.Expand(size); fPoolsLeg1.SetOwner(kTRUE);
-  fPoolsLeg2.Expand(size); fPoolsLeg2.SetOwner(kTRUE);
+  fPools.Expand(size); fPools.SetOwner(kTRUE);
   
   fPoolSize.Set(fNParallelCuts*size);
   for(Int_t i=0;i<fNParallelCuts*size;++i) fPoolSize[i] = 0;
@@ -180,31 +178,21 @@ void AliMixingHandler::FillEvent(TList* leg1List, TList* leg2List, Float_t* valu
   Int_t category = FindEventCategory(values[fCentralityVariable], values[fEventVertexVariable], values[fEventPlaneVariable]);
   if(category<0) return;   // event characteristics outside the defined ranges
   
-  TClonesArray *leg1PoolP = static_cast<TClonesArray*>(fPoolsLeg1.At(category));
-  if(!leg1PoolP) leg1PoolP = new(fPoolsLeg1[category]) TClonesArray("TList",1);
-  leg1PoolP->SetOwner(kTRUE);
-  TClonesArray *leg2PoolP=static_cast<TClonesArray*>(fPoolsLeg2.At(category));
-  if(!leg2PoolP) leg2PoolP = new(fPoolsLeg2[category]) TClonesArray("TList",1);
-  leg2PoolP->SetOwner(kTRUE);
-  
-  TClonesArray &leg1Pool=*leg1PoolP;
-  TClonesArray &leg2Pool=*leg2PoolP;
+  AliMixingPool* pool = static_cast<AliMixingPool*>(fPools.At(category));
+  if(!pool) {
+    pool = new AliMixingPool();
+    fPools.AddAt(pool, category);
+  }
   
-  // add the leg lists to the appropriate pools
-  TList *list1 = new(leg1Pool[leg1Pool.GetEntries()]) TList();
-  TList *list2 = new(leg2Pool[leg2Pool.GetEntries()]) TList();
-  list1->SetOwner(kTRUE); list2->SetOwner(kTRUE);
-  for(Int_t it=0; it<leg1List->GetEntries(); ++it) 
-    list1->Add(leg1List->At(it)->Clone());
-  for(Int_t it=0; it<leg2List->GetEntries(); ++it) 
-    list2->Add(leg2List->At(it)->Clone());
+  // add the kinematics and flags of the legs to the pool of this category
+  pool->AddEvent(leg1List, leg2List);
     
   // increment the size of the pools in this category
   ULong_t mixingMask = IncrementPoolSizes(leg1List,leg2List,category);
   
   // if full pool(s) were found then run the event mixing
   if(mixingMask) {
-    RunEventMixing(leg1PoolP,leg2PoolP,mixingMask,type,values);
+    RunEventMixing(pool,mixingMask,type,values);
     ResetPoolSizes(mixingMask,category);
   }
 }
@@ -357,11 +345,9 @@ void AliMixingHandler::RunLeftoverMixing(Int_t type) {
   for(Int_t i=0; i<fNParallelCuts; ++i) mixingMask |= (ULong_t(1)<<i);
   Float_t values[AliReducedVarManager::kNVars];
   
-  for(Int_t icateg=0; icateg<fPoolsLeg1.GetEntries(); ++icateg) {
-    TClonesArray *leg1Pool = static_cast<TClonesArray*>(fPoolsLeg1.At(icateg));
-    TClonesArray *leg2Pool = static_cast<TClonesArray*>(fPoolsLeg2.At(icateg));
-    if(!leg1Pool) continue;
-    if(!leg2Pool) continue;
+  for(Int_t icateg=0; icateg<fPools.GetEntries(); ++icateg) {
+    AliMixingPool* pool = static_cast<AliMixingPool*>(fPools.At(icateg));
+    if(!pool) continue;
     Int_t centBin = GetCentralityBin(icateg);
     Int_t zBin = GetEventVertexBin(icateg);
     Int_t epBin = GetEventPlaneBin(icateg);
@@ -369,207 +355,88 @@ void AliMixingHandler::RunLeftoverMixing(Int_t type) {
     values[fCentralityVariable] = 0.5*(fCentralityLimits[centBin]+fCentralityLimits[centBin+1]);
     values[fEventVertexVariable] = 0.5*(fEventVertexLimits[zBin]+fEventVertexLimits[zBin+1]);
     values[fEventPlaneVariable] = 0.5*(fEventPlaneLimits[epBin]+fEventPlaneLimits[epBin+1]);
-    RunEventMixing(leg1Pool,leg2Pool,mixingMask,type,values);
+    RunEventMixing(pool,mixingMask,type,values);
     ResetPoolSizes(mixingMask,icateg);
   }  // end loop over categories
 }
 
 
 //_________________________________________________________________________
-void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask,
-				      Int_t type, Float_t* values) {
+void AliMixingHandler::RunEventMixing(AliMixingPool* pool, ULong_t mixingMask, Int_t type, Float_t* values) {
   //
   // Run event mixing
   // NOTE: The mixingMask is a bit map with bits toggled for the pools which need mixing
   //       The type is the pair candidate type. It is used in AliReducedPairInfo::CandidateType, mainly to know which mass assumption to be made for the legs
+  //       The events, and the legs within each event, are paired in the order they were added to the pool
   //
-  //cout << "AliMixingHandler::RunEventMixing for mask " << flush;
-  //AliReducedVarManager::PrintBits(mixingMask,fNParallelCuts);
-  //cout << ";  (cent/vtx/ep): " << values[fCentralityVariable] << "/"
-  //     << values[fEventVertexVariable] << "/" << values[fEventPlaneVariable] << endl;
-  
-  Int_t entries = leg1Pool->GetEntries();
+  Int_t entries = pool->GetNEvents();
   if(entries<2) return;
   
+  // histogram class handles for each cut and pair type (++, +- and --)
   TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  TArrayI histClass(histClassArr->GetEntries());
+  for(Int_t i=0; i<histClassArr->GetEntries(); ++i)
+    histClass[i] = fHistos->GetHistClassIndex(histClassArr->At(i)->GetName());
+  delete histClassArr;
+  
+  const Float_t* px[2] = {pool->Px(0), pool->Px(1)};
+  const Float_t* py[2] = {pool->Py(0), pool->Py(1)};
+  const Float_t* pz[2] = {pool->Pz(0), pool->Pz(1)};
+  const Float_t* p[2] = {pool->P(0), pool->P(1)};
+  const Short_t* charge[2] = {pool->Charge(0), pool->Charge(1)};
+  const ULong_t* flags[2] = {pool->Flags(0), pool->Flags(1)};
+  
+  // leg combinations (leg of event 1, leg of event 2, pair type histogram offset):
+  // cross pairs leg1-leg2, then like-sign pairs leg1-leg1 and leg2-leg2
+  const Int_t kNCombinations = 3;
+  const Int_t legEv1[kNCombinations] = {0, 0, 1};
+  const Int_t legEv2[kNCombinations] = {1, 0, 1};
+  const Int_t histOffset[kNCombinations] = {1, 0, 2};
   
-  TIter iterEv1Leg1Pool(leg1Pool);
-  TIter iterEv1Leg2Pool(leg2Pool);
   ULong_t testFlags1 = 0;
   ULong_t testFlags2 = 0;
   for(Int_t iev1=0; iev1<entries; ++iev1) {                            // first event loop
-    // get the lists of leg1 and leg2 tracks for the first event
-    TList* ev1Leg1List = (TList*)iterEv1Leg1Pool();
-    TList* ev1Leg2List = (TList*)iterEv1Leg2Pool();
-    //cout << "## iev1 " << iev1 << endl;
-    
-    TIter iterEv2Leg1Pool(leg1Pool);
-    TIter iterEv2Leg2Pool(leg2Pool);
     for(Int_t iev2=0; iev2<entries; ++iev2) {                         // second event loop 
-      TList* ev2Leg1List = (TList*)iterEv2Leg1Pool();
-      TList* ev2Leg2List = (TList*)iterEv2Leg2Pool();
       if(iev1==iev2) continue;
-      //cout << "#### iev2 " << iev2 << endl;
       
-      //loop over the ev1-leg1 list
-      TIter iterLeg1(ev1Leg1List);
-      AliReducedBaseTrack* ev1Leg1=0x0;
-      while((ev1Leg1=(AliReducedBaseTrack*)iterLeg1())) {
-	// check that this track has at least one common bit with the mixing mask
-	testFlags1 = mixingMask & ev1Leg1->GetFlags();
-        //cout << "###### ev1Leg1 (p/px/testFlags1): " << ev1Leg1->P() << "/" << ev1Leg1->Px() << "/";
-        //AliReducedVarManager::PrintBits(testFlags1, fNParallelCuts); cout << endl;
-	if(!testFlags1) continue;
-	
-	//loop over the ev2-leg2 list 
-	TIter iterLeg2(ev2Leg2List);
-	AliReducedBaseTrack* ev2Leg2=0x0;
-	while((ev2Leg2=(AliReducedBaseTrack*)iterLeg2())) {
-	  // check that this track has at least one common bit with the mixing mask and with ev1-leg1
-	  testFlags2 = testFlags1 & ev2Leg2->GetFlags();
-          //cout << "###### ev2Leg2 (p/px/testFlags1): " << ev2Leg2->P() << "/" << ev2Leg2->Px() << "/";
-          //AliReducedVarManager::PrintBits(testFlags2, fNParallelCuts); cout << endl;
-	  if(!testFlags2) continue;
-	  
-	  // fill cross-pairs (leg1 - leg2) for the enabled bits
-	  AliReducedVarManager::FillPairInfoME(ev1Leg1, ev2Leg2, type, values);
-          //cout << "######## cross-pair (mass): " << values[AliReducedVarManager::kMass] << endl;
-	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+1)->GetName(), values);
-          }  
-	}  // end loop over the ev2-leg2 list
-	
-	if(!fMixLikeSign) continue;
-	// loop over the ev2-leg1 list
-	TIter iterLeg1LS(ev2Leg1List);
-	AliReducedBaseTrack* ev2Leg1=0x0;
-	while((ev2Leg1=(AliReducedBaseTrack*)iterLeg1LS())) {
-	  // check that this track has at least one common bit with the mixing mask and with ev1-leg1
-	  testFlags2 = testFlags1 & ev2Leg1->GetFlags();
-          //cout << "###### ev2Leg1 (p/px/testFlags2): " << ev2Leg1->P() << "/" << ev2Leg1->Px() << "/";
-          //AliReducedVarManager::PrintBits(testFlags2, fNParallelCuts); cout << endl;
-	  if(!testFlags2) continue;
-	  
-	  // fill like-pairs (leg1 - leg1) for the enabled bits
-	  AliReducedVarManager::FillPairInfoME(ev1Leg1, ev2Leg1, type, values);
-          //cout << "######## like-pair leg1-leg1 (mass): " << values[AliReducedVarManager::kMass] << endl;
-	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+0)->GetName(), values);
-          }  
-	}  // end loop over the ev2-leg1 list
-      }  // end loop over the ev1-leg1 list
-      
-      if(!fMixLikeSign) continue;
-      //loop over the ev1-leg2 list
-      TIter iterLeg2(ev1Leg2List);
-      AliReducedBaseTrack* ev1Leg2=0x0;
-      while((ev1Leg2=(AliReducedBaseTrack*)iterLeg2())) {
-	// check that this track has at least one common bit with the mixing mask
-	testFlags1 = mixingMask & ev1Leg2->GetFlags();
-        //cout << "###### ev1Leg2 (p/px/testFlags1): " << ev1Leg2->P() << "/" << ev1Leg2->Px() << "/";
-        //AliReducedVarManager::PrintBits(testFlags1, fNParallelCuts); cout << endl;
-	if(!testFlags1) continue;
-	
-	//loop over the ev2-leg2 list 
-	TIter iterLeg2LS(ev2Leg2List);
-	AliReducedBaseTrack* ev2Leg2=0x0;
-	while((ev2Leg2=(AliReducedBaseTrack*)iterLeg2LS())) {
-	  // check that this track has at least one common bit with the mixing mask and with ev1-leg1
-	  testFlags2 = testFlags1 & ev2Leg2->GetFlags();
-          //cout << "###### ev2Leg2 (p/px/testFlags2): " << ev2Leg2->P() << "/" << ev2Leg2->Px() << "/";
-          //AliReducedVarManager::PrintBits(testFlags2, fNParallelCuts); cout << endl;
-	  if(!testFlags2) continue;
-	  
-	  // fill like-pairs (leg2 - leg2) for the enabled bits
-	  AliReducedVarManager::FillPairInfoME(ev1Leg2, ev2Leg2, type, values);
-          //cout << "######## like-pair leg2-leg2 (mass): " << values[AliReducedVarManager::kMass] << endl;
-	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-            if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+2)->GetName(), values);
-          }  
-	}  // end loop over the ev2-leg2 list
-      }  // end loop over the ev1-leg2 list
+      // loop over the ev1-leg1 list and then over the ev1-leg2 list
+      for(Int_t leg1=0; leg1<2; ++leg1) {
+        if(leg1==1 && !fMixLikeSign) break;
+        for(Int_t i1=pool->GetFirst(leg1,iev1); i1<pool->GetFirst(leg1,iev1+1); ++i1) {
+          // check that this track has at least one common bit with the mixing mask
+          testFlags1 = mixingMask & flags[leg1][i1];
+          if(!testFlags1) continue;
+          
+          for(Int_t icomb=0; icomb<kNCombinations; ++icomb) {
+            if(legEv1[icomb]!=leg1) continue;
+            if(icomb>0 && !fMixLikeSign) break;
+            Int_t leg2 = legEv2[icomb];
+            
+            // loop over the legs of the second event
+            for(Int_t i2=pool->GetFirst(leg2,iev2); i2<pool->GetFirst(leg2,iev2+1); ++i2) {
+              // check that this track has at least one common bit with the mixing mask and with the ev1 leg
+              testFlags2 = testFlags1 & flags[leg2][i2];
+              if(!testFlags2) continue;
+              
+              // fill the pairs for the enabled bits
+              AliReducedVarManager::FillPairInfoME(px[leg1][i1], py[leg1][i1], pz[leg1][i1], p[leg1][i1], charge[leg1][i1],
+                                                   px[leg2][i2], py[leg2][i2], pz[leg2][i2], p[leg2][i2], charge[leg2][i2],
+                                                   type, values);
+              for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
+                if((testFlags2)&(ULong_t(1)<<ibit)) 
+                  fHistos->FillHistClass(histClass[ibit*3+histOffset[icomb]], values);
+              }
+            }  // end loop over the ev2 legs
+          }  // end loop over leg combinations
+        }  // end loop over the ev1 legs
+      }  // end loop over ev1 lists
     }  // end second event loop
   }  // end first event loop
   
-  // unset the mixing flags --------------------------------------
-  iterEv1Leg1Pool.Reset(); 
-  iterEv1Leg2Pool.Reset();
-  //cout << "Unsetting bits for which mixing was performed" << endl;
-  for(Int_t ie1=0; ie1<entries; ++ie1) {
-    TList* leg1List = (TList*)iterEv1Leg1Pool();        
-    TIter iterLeg1(leg1List);
-    AliReducedBaseTrack* track=0x0;
-    while((track=(AliReducedBaseTrack*)iterLeg1())) {
-      //cout << "leg1 p " << track->P() << "     " << flush; 
-      //AliReducedVarManager::PrintBits(track->GetFlags(),fNParallelCuts); cout << "/" << flush;
-      testFlags1 = mixingMask & track->GetFlags();
-      if(!testFlags1) {
-	//AliReducedVarManager::PrintBits(track->GetFlags(),fNParallelCuts); cout << endl;
-	continue;
-      }
-      for(UShort_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-	if((testFlags1)&(ULong_t(1)<<ibit)) 
-	  track->UnsetFlag(ibit);
-      }
-      //AliReducedVarManager::PrintBits(track->GetFlags(),fNParallelCuts); cout << endl;
-    }  // end loop over the first leg list
-    
-    TList* leg2List = (TList*)iterEv1Leg2Pool();
-    TIter iterLeg2(leg2List);
-    while((track=(AliReducedBaseTrack*)iterLeg2())) {
-      //cout << "leg2 p " << track->P() << "     " << flush; 
-      //AliReducedVarManager::PrintBits(track->GetFlags(),fNParallelCuts); cout << "/" << flush;
-      testFlags1 = mixingMask & track->GetFlags();
-      if(!testFlags1) {
-	//AliReducedVarManager::PrintBits(track->GetFlags(),fNParallelCuts); cout << endl;
-	continue;
-      }
-      for(UShort_t ibit=0; ibit<fNParallelCuts; ++ibit) {
-	if((testFlags1)&(ULong_t(1)<<ibit)) 
-	  track->UnsetFlag(ibit);
-      }
-      //AliReducedVarManager::PrintBits(track->GetFlags(),fNParallelCuts); cout << endl;
-    }  // end loop over the second leg list
-  }  // end loop over events
-  
-  // clean the tracks which don't have enabled mixing flags anymore
-  AliReducedBaseTrack* track=0x0;
-  // leg1 lists
-  iterEv1Leg1Pool.Reset(); TList* leg1List=0x0;
-  while((leg1List=(TList*)iterEv1Leg1Pool())) {
-    TIter iterLeg1(leg1List);
-    while((track=(AliReducedBaseTrack*)iterLeg1())) {
-      //AliReducedVarManager::PrintBits(track->GetFlags(),fNParallelCuts); cout << flush;
-      if(!track->GetFlags()) {
-         leg1List->Remove(track); delete track;
-      }
-    }
-  }  // end while
-  // leg2 lists
-  iterEv1Leg2Pool.Reset(); TList* leg2List=0x0;
-  while((leg2List=(TList*)iterEv1Leg2Pool())) {  
-    TIter iterLeg2(leg2List);
-    while((track=(AliReducedBaseTrack*)iterLeg2())) {
-      //AliReducedVarManager::PrintBits(track->GetFlags(),fNParallelCuts); cout << flush;
-      if(!track->GetFlags()) {
-         leg2List->Remove(track); delete track;
-      }
-    }
-  }  // end while
-  
-  // clean the events without any tracks left
-  for(Int_t i=leg1Pool->GetEntries()-1;i>=0;--i) {
-    leg1List=(TList*)leg1Pool->At(i);
-    leg2List=(TList*)leg2Pool->At(i);
-    if(leg1List->GetEntries()==0 && 
-       leg2List->GetEntries()==0) {
-       leg1Pool->RemoveAt(i); leg1Pool->Compress(); //delete leg1List;
-       leg2Pool->RemoveAt(i); leg2Pool->Compress(); //delete leg2List;
-    }
-  }
+  // unset the mixing flags, then clean the tracks which don't have enabled mixing flags anymore
+  // and the events without any tracks left
+  pool->UnsetFlags(mixingMask);
+  pool->Compress();
 }
 
 
@@ -607,7 +474,6 @@ void AliMixingHandler::PrintMixingLists(Int_t debugLevel) {
   if(debugLevel<1) return;
   
   Int_t nCategories = (fCentralityLimits.GetSize()-1)*(fEventVertexLimits.GetSize()-1)*(fEventPlaneLimits.GetSize()-1);
-  AliReducedBaseTrack* track = 0x0;
   
   for(Int_t icent=0; icent<fCentralityLimits.GetSize()-1; ++icent) {
     for(Int_t iz=0; iz<fEventVertexLimits.GetSize()-1; ++iz) {
@@ -626,41 +492,25 @@ void AliMixingHandler::PrintMixingLists(Int_t debugLevel) {
 	cout << endl;
 	if(debugLevel<2) continue;
 	
-	TClonesArray *leg1PoolP = static_cast<TClonesArray*>(fPoolsLeg1.At(evCategory));
-	if(!leg1PoolP) continue;
-        TClonesArray &leg1Pool=*leg1PoolP;
-	TClonesArray *leg2PoolP = static_cast<TClonesArray*>(fPoolsLeg2.At(evCategory));
+	AliMixingPool* pool = static_cast<AliMixingPool*>(fPools.At(evCategory));
+	if(!pool) continue;
 	
-        TIter iterLeg1Pool(leg1PoolP);
-	TIter iterLeg2Pool(leg2PoolP);
-	for(Int_t iev=0; iev<leg1Pool.GetEntries(); ++iev) {
-	  TList* leg1List = (TList*)iterLeg1Pool();
-	  TList* leg2List = (TList*)iterLeg2Pool();
+	for(Int_t iev=0; iev<pool->GetNEvents(); ++iev) {
 	  cout << "	Event #" << iev << ";  No. of tracks (leg1/leg2) :: " 
-	       << leg1List->GetEntries() << " / " << leg2List->GetEntries() << endl;
+	       << pool->GetNLegs(0,iev) << " / " << pool->GetNLegs(1,iev) << endl;
 	  if(debugLevel<3) continue;
 	  
-	  TIter iterLeg1List(leg1List);
-	  cout << "		Leg1 list" << endl;
-	  for(Int_t itrack=0; itrack<leg1List->GetEntries(); ++itrack) {
-	    track = (AliReducedBaseTrack*)iterLeg1List();
-	    cout << "		track #" << itrack << " (p/px/py/pz/charge/flags) :: "
-	         << track->P() << " / " << track->Px() << " / " 
-                 << track->Py() << " / " << track->Pz() << "/" << track->Charge() << " / " << flush;
-	    AliReducedVarManager::PrintBits(track->GetFlags(), fNParallelCuts);	 
-	    cout << endl;
-	  }  // end loop over tracks
-	  
-	  TIter iterLeg2List(leg2List);
-	  cout << "		Leg2 list" << endl;
-	  for(Int_t itrack=0; itrack<leg2List->GetEntries(); ++itrack) {
-	    track = (AliReducedBaseTrack*)iterLeg2List();
-	    cout << "		track #" << itrack << " (p/px/py/pz/charge/flags) :: "
-	         << track->P() << " / " << track->Px() << " / " 
-                 << track->Py() << " / " << track->Pz() << "/" << track->Charge() << " / " << flush;
-	    AliReducedVarManager::PrintBits(track->GetFlags(), fNParallelCuts);	 
-	    cout << endl;
-	  }  // end loop over tracks
+	  for(Int_t leg=0; leg<2; ++leg) {
+	    cout << "		Leg" << leg+1 << " list" << endl;
+	    for(Int_t itrack=0; itrack<pool->GetNLegs(leg,iev); ++itrack) {
+	      Int_t i = pool->GetFirst(leg,iev)+itrack;
+	      cout << "		track #" << itrack << " (p/px/py/pz/charge/flags) :: "
+	           << pool->P(leg)[i] << " / " << pool->Px(leg)[i] << " / " 
+	           << pool->Py(leg)[i] << " / " << pool->Pz(leg)[i] << "/" << Int_t(pool->Charge(leg)[i]) << " / " << flush;
+	      AliReducedVarManager::PrintBits(pool->Flags(leg)[i], fNParallelCuts);	 
+	      cout << endl;
+	    }  // end loop over tracks
+	  }  // end loop over leg lists
 	  
 	}  // end loop over events
       }  // end loop over event plane intervals
@@ -10,13 +10,15 @@
 #include <TNamed.h>
 #include <TArrayF.h>
 #include <TArrayI.h>
-#include <TClonesArray.h>
+#include <TObjArray.h>
 #include <TList.h>
 #include <TString.h>
 
 #include "AliHistogramManager.h"
 #include "AliReducedVarManager.h"
 
+class AliMixingPool;
+
 class AliMixingHandler : public TNamed {
 
 public:
@@ -68,8 +70,7 @@ private:
   Float_t fDownscaleEvents;      // random downscale adding events to the pools
   Float_t fDownscaleTracks;      // random downscale adding tracks fo the pools
   
-  TClonesArray fPoolsLeg1;         // array of pools
-  TClonesArray fPoolsLeg2;         // array of pools
+  TObjArray fPools;                //! array of pools (AliMixingPool), one per event category
   Int_t fNParallelCuts;            // number of parallel cuts which are run
   TString fHistClassNames;         // name of the histogram classes for each cut, separated by a semicolon ";"
   TArrayI fPoolSize;               // counters for the pool sizes
@@ -85,11 +86,11 @@ private:
   
   AliHistogramManager* fHistos;    // histogram manager
   
-  void RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask, Int_t type, Float_t* values);
+  void RunEventMixing(AliMixingPool* pool, ULong_t mixingMask, Int_t type, Float_t* values);
   ULong_t IncrementPoolSizes(TList* list1, TList* list2, Int_t eventCategory);
   void ResetPoolSizes(ULong_t mixingMask, Int_t category);  
   
-  ClassDef(AliMixingHandler,1);
+  ClassDef(AliMixingHandler,2);
 };
 
 #endif
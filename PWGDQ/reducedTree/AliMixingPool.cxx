@@ -0,0 +1,127 @@
+/*
+***********************************************************
+  Implementation of the AliMixingPool class
+  *********************************************************
+*/
+
+#ifndef ALIMIXINGPOOL_H
+#include "AliMixingPool.h"
+#endif
+
+#include <TList.h>
+
+#include "AliReducedBaseTrack.h"
+
+ClassImp(AliMixingPool);
+
+//_________________________________________________________________________
+AliMixingPool::AliMixingPool() :
+  TObject(),
+  fNEvents(0),
+  fFirst(),
+  fPx(),
+  fPy(),
+  fPz(),
+  fP(),
+  fCharge(),
+  fFlags()
+{
+  //
+  // default constructor
+  //
+  fFirst[0].push_back(0);
+  fFirst[1].push_back(0);
+}
+
+
+//_________________________________________________________________________
+AliMixingPool::~AliMixingPool() {
+  //
+  // destructor
+  //
+}
+
+
+//_________________________________________________________________________
+void AliMixingPool::Clear(Option_t* /*option*/) {
+  //
+  // remove all events, the allocated memory is kept
+  //
+  fNEvents = 0;
+  for(Int_t leg=0; leg<2; ++leg) {
+    fFirst[leg].resize(1); 
+    fPx[leg].clear(); fPy[leg].clear(); fPz[leg].clear(); fP[leg].clear();
+    fCharge[leg].clear(); fFlags[leg].clear();
+  }
+}
+
+
+//_________________________________________________________________________
+void AliMixingPool::AddEvent(TList* leg1List, TList* leg2List) {
+  //
+  // add an event to the pool, copying the needed leg information
+  //
+  TList* lists[2] = {leg1List, leg2List};
+  for(Int_t leg=0; leg<2; ++leg) {
+    TIter nextTrack(lists[leg]);
+    AliReducedBaseTrack* track=0x0;
+    while((track=(AliReducedBaseTrack*)nextTrack())) {
+      fPx[leg].push_back(track->Px());
+      fPy[leg].push_back(track->Py());
+      fPz[leg].push_back(track->Pz());
+      fP[leg].push_back(track->P());
+      fCharge[leg].push_back(track->Charge());
+      fFlags[leg].push_back(track->GetFlags());
+    }
+    fFirst[leg].push_back(fFlags[leg].size());
+  }
+  ++fNEvents;
+}
+
+
+//_________________________________________________________________________
+void AliMixingPool::UnsetFlags(ULong_t mask) {
+  //
+  // unset the flags in mask for all the legs in the pool
+  //
+  for(Int_t leg=0; leg<2; ++leg) {
+    for(UInt_t i=0; i<fFlags[leg].size(); ++i) fFlags[leg][i] &= ~mask;
+  }
+}
+
+
+//_________________________________________________________________________
+void AliMixingPool::Compress() {
+  //
+  // remove the legs without any flag left and the events without any leg left,
+  // keeping the order of the remaining events and legs
+  //
+  Int_t nEvents = 0;
+  Int_t nLegs[2] = {0, 0};
+  Int_t oldFirst[2] = {0, 0};    // fFirst is overwritten while looping, keep the original start of the event
+  for(Int_t iev=0; iev<fNEvents; ++iev) {
+    Int_t first[2] = {nLegs[0], nLegs[1]};
+    for(Int_t leg=0; leg<2; ++leg) {
+      Int_t oldLast = fFirst[leg][iev+1];
+      for(Int_t i=oldFirst[leg]; i<oldLast; ++i) {
+        if(!fFlags[leg][i]) continue;
+        Int_t j = nLegs[leg]++;
+        fPx[leg][j] = fPx[leg][i]; fPy[leg][j] = fPy[leg][i]; fPz[leg][j] = fPz[leg][i]; fP[leg][j] = fP[leg][i];
+        fCharge[leg][j] = fCharge[leg][i]; fFlags[leg][j] = fFlags[leg][i];
+      }
+      oldFirst[leg] = oldLast;
+    }
+    // drop the event if both lists are empty
+    if(nLegs[0]==first[0] && nLegs[1]==first[1]) continue;
+    ++nEvents;
+    fFirst[0][nEvents] = nLegs[0];
+    fFirst[1][nEvents] = nLegs[1];
+  }
+  
+  fNEvents = nEvents;
+  for(Int_t leg=0; leg<2; ++leg) {
+    fFirst[leg].resize(fNEvents+1);
+    fPx[leg].resize(nLegs[leg]); fPy[leg].resize(nLegs[leg]); fPz[leg].resize(nLegs[leg]); fP[leg].resize(nLegs[leg]);
+    fCharge[leg].resize(nLegs[leg]); fFlags[leg].resize(nLegs[leg]);
+  }
+}
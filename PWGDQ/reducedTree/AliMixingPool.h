@@ -0,0 +1,57 @@
+// Compact event mixing pool for one event category
+//
+// Only the leg quantities needed to build mixed pairs are stored (momentum
+// components, momentum, charge and cut flags), in contiguous arrays for each
+// of the two leg lists. The tracks of one event are stored consecutively and
+// events are stored in the order they were added.
+//
+#ifndef ALIMIXINGPOOL_H
+#define ALIMIXINGPOOL_H
+
+#include <vector>
+
+#include <TObject.h>
+
+class TList;
+
+//_____________________________________________________________________
+class AliMixingPool : public TObject {
+
+ public:
+  AliMixingPool();
+  virtual ~AliMixingPool();
+  
+  void AddEvent(TList* leg1List, TList* leg2List);
+  void UnsetFlags(ULong_t mask);
+  void Compress();
+  virtual void Clear(Option_t* option="");
+  
+  Int_t GetNEvents() const {return fNEvents;}
+  // range [GetFirst, GetFirst(event+1)) of the legs of an event, leg is 0 or 1
+  Int_t GetFirst(Int_t leg, Int_t event) const {return fFirst[leg][event];}
+  Int_t GetNLegs(Int_t leg, Int_t event) const {return fFirst[leg][event+1]-fFirst[leg][event];}
+  
+  const Float_t* Px(Int_t leg)      const {return fPx[leg].empty() ? 0x0 : &fPx[leg][0];}
+  const Float_t* Py(Int_t leg)      const {return fPy[leg].empty() ? 0x0 : &fPy[leg][0];}
+  const Float_t* Pz(Int_t leg)      const {return fPz[leg].empty() ? 0x0 : &fPz[leg][0];}
+  const Float_t* P(Int_t leg)       const {return fP[leg].empty() ? 0x0 : &fP[leg][0];}
+  const Short_t* Charge(Int_t leg)  const {return fCharge[leg].empty() ? 0x0 : &fCharge[leg][0];}
+  const ULong_t* Flags(Int_t leg)   const {return fFlags[leg].empty() ? 0x0 : &fFlags[leg][0];}
+  
+ private:
+  AliMixingPool(const AliMixingPool& pool);
+  AliMixingPool& operator=(const AliMixingPool& pool);
+  
+  Int_t fNEvents;                      // number of events in the pool
+  std::vector<Int_t>   fFirst[2];      //! index of the first leg of each event (fNEvents+1 values)
+  std::vector<Float_t> fPx[2];         //! px of the legs
+  std::vector<Float_t> fPy[2];         //! py of the legs
+  std::vector<Float_t> fPz[2];         //! pz of the legs
+  std::vector<Float_t> fP[2];          //! momentum of the legs
+  std::vector<Short_t> fCharge[2];     //! charge of the legs
+  std::vector<ULong_t> fFlags[2];      //! cut flags of the legs
+  
+  ClassDef(AliMixingPool, 1);
+};
+
+#endif
@@ -232,13 +232,15 @@ void AliReducedAnalysisJpsi2ee::Process() {
   // fill event information before event cuts
   AliReducedVarManager::FillEventInfo(fEvent, fValues);
   fHistosManager->FillHistClass("Event_BeforeCuts", fValues);
+  Int_t hClassTag = fHistosManager->GetHistClassIndex("EventTag_BeforeCuts");
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
+     fHistosManager->FillHistClass(hClassTag, fValues);
   }
+  Int_t hClassTriggers = fHistosManager->GetHistClassIndex("EventTriggers_BeforeCuts");
   for(UShort_t ibit=0; ibit<64; ++ibit) {
       AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-      fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(hClassTriggers, fValues);
   }
   
   
@@ -281,13 +283,15 @@ void AliReducedAnalysisJpsi2ee::Process() {
  
   // fill event info histograms after cuts
   fHistosManager->FillHistClass("Event_AfterCuts", fValues);
+  hClassTag = fHistosManager->GetHistClassIndex("EventTag_AfterCuts");
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
+     fHistosManager->FillHistClass(hClassTag, fValues);
   }
+  hClassTriggers = fHistosManager->GetHistClassIndex("EventTriggers_AfterCuts");
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-     fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
+     fHistosManager->FillHistClass(hClassTriggers, fValues);
   }
 }
 
@@ -327,22 +331,30 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedTrackInfo* track,
    Bool_t isMCTruth = fOptionRunOverMC && IsMCTruth(track);
    for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
       if(track->TestFlag(icut)) {
-         fHistosManager->FillHistClass(Form("%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         if(isMCTruth) fHistosManager->FillHistClass(Form("%s_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+         const Char_t* cutName = fTrackCuts.At(icut)->GetName();
+         fHistosManager->FillHistClass(Form("%s_%s", trackClass.Data(), cutName), fValues);
+         if(isMCTruth) fHistosManager->FillHistClass(Form("%s_%s_MCTruth", trackClass.Data(), cutName), fValues);
+         // get the class handles once, the flag histograms are filled for every flag / layer
+         Int_t hClass = fHistosManager->GetHistClassIndex(Form("%sStatusFlags_%s", trackClass.Data(), cutName));
+         Int_t hClassMC = (isMCTruth ? fHistosManager->GetHistClassIndex(Form("%sStatusFlags_%s_MCTruth", trackClass.Data(), cutName)) : -1);
          for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
             AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
-            fHistosManager->FillHistClass(Form("%sStatusFlags_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sStatusFlags_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(hClass, fValues);
+            if(isMCTruth) fHistosManager->FillHistClass(hClassMC, fValues);
          }
+         hClass = fHistosManager->GetHistClassIndex(Form("%sITSclusterMap_%s", trackClass.Data(), cutName));
+         hClassMC = (isMCTruth ? fHistosManager->GetHistClassIndex(Form("%sITSclusterMap_%s_MCTruth", trackClass.Data(), cutName)) : -1);
          for(Int_t iLayer=0; iLayer<6; ++iLayer) {
             AliReducedVarManager::FillITSlayerFlag(track, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sITSclusterMap_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(hClass, fValues);
+            if(isMCTruth) fHistosManager->FillHistClass(hClassMC, fValues);
          }
+         hClass = fHistosManager->GetHistClassIndex(Form("%sTPCclusterMap_%s", trackClass.Data(), cutName));
+         hClassMC = (isMCTruth ? fHistosManager->GetHistClassIndex(Form("%sTPCclusterMap_%s_MCTruth", trackClass.Data(), cutName)) : -1);
          for(Int_t iLayer=0; iLayer<8; ++iLayer) {
             AliReducedVarManager::FillTPCclusterBitFlag(track, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(hClass, fValues);
+            if(isMCTruth) fHistosManager->FillHistClass(hClassMC, fValues);
          }
       } // end if(track->TestFlag(icut))
    }  // end loop over cuts
@@ -379,24 +391,28 @@ void AliReducedAnalysisJpsi2ee::RunTrackSelection() {
    TClonesArray* trackList = fEvent->GetTracks();
    TIter nextTrack(trackList);
    Float_t nsigma = 0.;
+   Int_t hClassTrack = fHistosManager->GetHistClassIndex("Track_BeforeCuts");
+   Int_t hClassStatusFlags = fHistosManager->GetHistClassIndex("TrackStatusFlags_BeforeCuts");
+   Int_t hClassITSclusterMap = fHistosManager->GetHistClassIndex("TrackITSclusterMap_BeforeCuts");
+   Int_t hClassTPCclusterMap = fHistosManager->GetHistClassIndex("TrackTPCclusterMap_BeforeCuts");
    for(Int_t it=0; it<fEvent->NTracks(); ++it) {
       track = (AliReducedTrackInfo*)nextTrack();
       if(fOptionRunOverMC && track->IsMCTruth()) continue;
       //cout << "track " << it << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
       AliReducedVarManager::FillTrackInfo(track, fValues);
-      fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(hClassTrack, fValues);
       for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
          //cout << "track / tracking flags :: " << track << " / "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
          AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
-         fHistosManager->FillHistClass("TrackStatusFlags_BeforeCuts", fValues);
+         fHistosManager->FillHistClass(hClassStatusFlags, fValues);
       }
       for(Int_t iLayer=0; iLayer<6; ++iLayer) {
          AliReducedVarManager::FillITSlayerFlag(track, iLayer, fValues);
-         fHistosManager->FillHistClass("TrackITSclusterMap_BeforeCuts", fValues);
+         fHistosManager->FillHistClass(hClassITSclusterMap, fValues);
       }
       for(Int_t iLayer=0; iLayer<8; ++iLayer) {
          AliReducedVarManager::FillTPCclusterBitFlag(track, iLayer, fValues);
-         fHistosManager->FillHistClass("TrackTPCclusterMap_BeforeCuts", fValues);
+         fHistosManager->FillHistClass(hClassTPCclusterMap, fValues);
       }
       if(IsTrackSelected(track, fValues)) {
          fValues[AliReducedVarManager::kEvAverageTPCchi2] += track->TPCchi2();
@@ -5,9 +5,12 @@
 
 #include <TTree.h>
 #include <TFile.h>
+#include <TObjArray.h>
+#include "AliLog.h"
 #include "AliReducedEventInputHandler.h"
 #include "AliReducedBaseEvent.h"
 #include "AliReducedEventInfo.h"
+#include "AliReducedVarManager.h"
 
 ClassImp(AliReducedEventInputHandler)
 
@@ -15,6 +18,9 @@ ClassImp(AliReducedEventInputHandler)
 AliReducedEventInputHandler::AliReducedEventInputHandler() :
     AliInputEventHandler(),
     fEventInputOption(kReducedBaseEvent),
+    fReadUsedBranchesOnly(kFALSE),
+    fActiveBranches(""),
+    fUseMCBranches(kFALSE),
     fReducedEvent(0)
 {
   // Default constructor
@@ -24,6 +30,9 @@ AliReducedEventInputHandler::AliReducedEventInputHandler() :
 AliReducedEventInputHandler::AliReducedEventInputHandler(const char* name, const char* title):
   AliInputEventHandler(name, title),
   fEventInputOption(kReducedBaseEvent),
+  fReadUsedBranchesOnly(kFALSE),
+  fActiveBranches(""),
+  fUseMCBranches(kFALSE),
   fReducedEvent(0)
  {
     // Constructor
@@ -45,6 +54,7 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
 
     SwitchOffBranches();
     SwitchOnBranches();
+    if(fReadUsedBranchesOnly) SetUsedBranches();
     
     // Get pointer to the event
     if (!fReducedEvent) {
@@ -63,6 +73,36 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
 }
 
 
+//______________________________________________________________________________
+void AliReducedEventInputHandler::SetUsedBranches()
+{
+    //
+    // Read from the split track branches only the data members needed by the variables used
+    // in the cuts and histograms (see AliReducedVarManager::GetUsedTrackBranches()).
+    // The track objects are still filled, such that all accessors keep working for the members read,
+    // while the members of the switched off branches keep their default values.
+    // Members accessed directly by the analysis code can be added with SetActiveBranch().
+    // The MC truth members, used directly by the tasks running over MC, are read with SetUseMCBranches().
+    //
+    if(fEventInputOption!=kReducedEventInfo) return;
+    if(!fTree->GetBranch("fTracks")) {
+       AliWarning("Track branch not found or not split, all track data members will be read");
+       return;
+    }
+    
+    TString branches = AliReducedVarManager::GetUsedTrackBranches("fTracks", fUseMCBranches);
+    branches += fActiveBranches;
+    
+    fTree->SetBranchStatus("fTracks.*", 0);
+    TObjArray* arr = branches.Tokenize(";");
+    for(Int_t i=0; i<arr->GetEntries(); ++i) {
+       fTree->SetBranchStatus(arr->At(i)->GetName(), 1);
+    }
+    AliInfo(Form("Reading only the track branches: %s", branches.Data()));
+    delete arr;
+}
+
+
 //______________________________________________________________________________
 Bool_t AliReducedEventInputHandler::BeginEvent(Long64_t entry)
 {
@@ -6,6 +6,7 @@
 //     Author: Ionut-Cristian Arsene, iarsene@cern.ch, i.c.arsene@fys.uio.no
 //
 
+#include <TString.h>
 #include "AliInputEventHandler.h"
 #include "AliReducedBaseEvent.h"
 //#include "AliReducedEventInfo.h"
@@ -33,16 +34,26 @@ class AliReducedEventInputHandler : public AliInputEventHandler {
              
                  void                                SetInputEventType(Int_t type) {fEventInputOption = type;} ;
                  Int_t                               GetInputEventType() const {return fEventInputOption;};
+                 void                                SetReadUsedBranchesOnly(Bool_t flag=kTRUE) {fReadUsedBranchesOnly = flag;}
+                 Bool_t                              GetReadUsedBranchesOnly() const {return fReadUsedBranchesOnly;}
+                 void                                SetActiveBranch(TString b) {fActiveBranches+=b+";";}
+                 void                                SetUseMCBranches(Bool_t flag=kTRUE) {fUseMCBranches = flag;}
+                 Bool_t                              GetUseMCBranches() const {return fUseMCBranches;}
                  
  private:
     AliReducedEventInputHandler(const AliReducedEventInputHandler& handler);             
     AliReducedEventInputHandler& operator=(const AliReducedEventInputHandler& handler);      
     
+    void SetUsedBranches();
+    
     Int_t  fEventInputOption;                          // one of the options listed in EReducedEventInputType
+    Bool_t fReadUsedBranchesOnly;                      // read only the track data members needed by the used variables
+    TString fActiveBranches;                           // ";" separated list of extra branches read with fReadUsedBranchesOnly
+    Bool_t fUseMCBranches;                             // read also the MC truth track data members with fReadUsedBranchesOnly
     AliReducedBaseEvent* fReducedEvent;   //! Pointer to the event
     //AliReducedEventInfo* fReducedEvent;   //! Pointer to the event
     
-    ClassDef(AliReducedEventInputHandler, 2);
+    ClassDef(AliReducedEventInputHandler, 4);
 };
 
 #endif
@@ -284,6 +284,72 @@ void AliReducedVarManager::SetVariableDependencies() {
   }
 }
 
+//__________________________________________________________________
+TString AliReducedVarManager::GetUsedTrackBranches(const Char_t* arrayName /*="fTracks"*/, Bool_t useMC /*=kFALSE*/) {
+  //
+  // Return the ";" separated list of the split track branches needed to compute the used variables
+  //   The base track information, the tracking status, track id and ITS cluster map are always needed since
+  //   they are accessed directly by the cuts and analysis tasks.
+  //   The MC truth members are read whenever useMC is set, since the analysis tasks access them directly (e.g. MCPdg()).
+  //   Array members are given with a trailing wildcard since their branch names carry the dimension (e.g. fDCA[2])
+  //
+  struct TrackBranch {
+    Int_t fVar;             // first variable
+    Int_t fNVars;           // number of consecutive variables
+    const Char_t* fMembers; // "," separated list of AliReducedTrackInfo data members
+  };
+  const TrackBranch kTrackBranches[] = {
+    {kPtTPC, 1, "fTPCPt"},                 {kPhiTPC, 1, "fTPCPhi"},                {kEtaTPC, 1, "fTPCEta"},
+    {kDcaXYTPC, 2, "fTPCDCA*"},            {kPin, 1, "fMomentumInner"},            {kDcaXY, 2, "fDCA*"},
+    {kTrackLength, 1, "fTrackLength"},     {kChi2TPCConstrainedVsGlobal, 1, "fChi2TPCConstrainedVsGlobal"},
+    {kMassUsedForTracking, 1, "fMassForTracking"},
+    {kITSncls, 1, "fITSclusterMap"},       {kNclsSFracITS, 1, "fITSclusterMap,fITSSharedClusterMap"},
+    {kITSchi2, 1, "fITSchi2"},             {kITSnclsShared, 1, "fITSSharedClusterMap"},
+    {kITSlayerHit, 1, "fITSclusterMap"},   {kITSsignal, 1, "fITSsignal"},          {kITSnSig, 4, "fITSnSig*"},
+    {kTPCncls, 1, "fTPCNcls"},             {kTPCchi2, 1, "fTPCchi2"},
+    {kTPCclusBitFired, 2, "fTPCClusterMap"},
+    {kTPCclustersPerBit, 1, "fTPCClusterMap,fTPCNcls"},
+    {kTPCcrossedRows, 1, "fTPCCrossedRows"}, {kTPCnclsF, 1, "fTPCNclsF"},          {kTPCnclsShared, 1, "fTPCNclsShared"},
+    {kTPCnclsSharedRatio, 1, "fTPCNclsShared,fTPCNcls"},
+    {kTPCnclsRatio, 1, "fTPCNcls,fTPCNclsF"},
+    {kTPCnclsRatio2, 1, "fTPCNcls,fTPCCrossedRows"},
+    {kTPCcrossedRowsOverFindableClusters, 2, "fTPCCrossedRows,fTPCNclsF"},
+    {kTPCsignal, 1, "fTPCsignal"},         {kTPCsignalN, 1, "fTPCsignalN"},
+    {kTPCnSig, 8, "fTPCnSig*"},
+    {kTOFbeta, 1, "fTOFbeta"},             {kTOFtime, 1, "fTOFtime"},              {kTOFdx, 1, "fTOFdx"},
+    {kTOFdz, 1, "fTOFdz"},                 {kTOFmismatchProbability, 1, "fTOFmismatchProbab"},
+    {kTOFchi2, 1, "fTOFchi2"},             {kTOFdeltaBC, 1, "fTOFdeltaBC"},        {kTOFnSig, 4, "fTOFnSig*"},
+    {kTRDntracklets, 2, "fTRDntracklets*"},
+    {kTRDpidProbabilitiesLQ1D, 2, "fTRDpid*"}, {kTRDpidProbabilitiesLQ2D, 2, "fTRDpidLQ2D*"},
+    {kEMCALmatchedEnergy, 3, "fCaloClusterId"},
+    {kPairDca, 6, "fDCA*"},                {kMassDcaPtCorr, 2, "fDCA*"},           {kDMA, 1, "fHelix*"},
+    {kPairLegITSchi2, 2, "fITSchi2"},      {kPairLegTPCchi2, 2, "fTPCchi2"},
+    {kPtMC, 1, "fMC*"}, {kPMC, 1, "fMC*"}, {kPxMC, 1, "fMC*"}, {kPyMC, 1, "fMC*"}, {kPzMC, 1, "fMC*"},
+    {kThetaMC, 1, "fMC*"}, {kEtaMC, 1, "fMC*"}, {kPhiMC, 1, "fMC*"}, {kMassMC, 1, "fMC*"}, {kRapMC, 1, "fMC*"},
+    {kPdgMC, 4, "fMC*"}
+  };
+  const Int_t nEntries = sizeof(kTrackBranches)/sizeof(TrackBranch);
+  
+  TString members = "fP*,fIsCartesian,fCharge,fFlags,fQualityFlags,fTrackId,fStatus,fITSclusterMap";
+  if(useMC) members += ",fMC*";
+  for(Int_t i=0; i<nEntries; ++i) {
+    Bool_t used = kFALSE;
+    for(Int_t iv=0; iv<kTrackBranches[i].fNVars; ++iv)
+      if(fgUsedVars[kTrackBranches[i].fVar+iv]) {used = kTRUE; break;}
+    if(used) {members += ","; members += kTrackBranches[i].fMembers;}
+  }
+  
+  // remove duplicates and prepend the array name
+  TString branches = "";
+  TObjArray* arr = members.Tokenize(",");
+  for(Int_t i=0; i<arr->GetEntries(); ++i) {
+    TString branch = Form("%s.%s;", arrayName, arr->At(i)->GetName());
+    if(!branches.Contains(branch)) branches += branch;
+  }
+  delete arr;
+  return branches;
+}
+
 //__________________________________________________________________
 void AliReducedVarManager::FillEventInfo(Float_t* values) {
   //
@@ -1498,13 +1564,26 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
+  FillPairInfoME(t1->Px(), t1->Py(), t1->Pz(), t1->P(), t1->Charge(),
+                 t2->Px(), t2->Py(), t2->Pz(), t2->P(), t2->Charge(), type, values);
+}
+
+
+//_________________________________________________________________
+void AliReducedVarManager::FillPairInfoME(Float_t px1, Float_t py1, Float_t pz1, Float_t p1, Int_t charge1,
+                                          Float_t px2, Float_t py2, Float_t pz2, Float_t p2, Int_t charge2,
+                                          Int_t type, Float_t* values) {
+  //
+  // Lightweight fill pair information from the leg momenta and charges
+  // NOTE: Used by the event mixing handler, which stores only these quantities for the legs
+  //
   PAIR p;
-  p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
+  p.PxPyPz(px1+px2, py1+py2, pz1+pz2);
   p.CandidateId(type);
     
-  if(t1->Charge()*t2->Charge()<0) p.PairType(1);
-  else if(t1->Charge()>0)         p.PairType(0);
-  else                            p.PairType(2);
+  if(charge1*charge2<0) p.PairType(1);
+  else if(charge1>0)    p.PairType(0);
+  else                  p.PairType(2);
   values[kPairType] = p.PairType();
   values[kCandidateId] = type;
   values[kPairChisquare] = -999.;
@@ -1514,14 +1593,14 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
     
   if(fgUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
-                    2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
-                    t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
+                    2.0*(TMath::Sqrt(m1*m1+p1*p1)*TMath::Sqrt(m2*m2+p2*p2) - 
+                    px1*px2 - py1*py2 - pz1*pz2);
     if(values[kMass]<0.0) {
       cout << "FillPairInfoME(track, track, type, values): Warning: Very small squared mass found. "
            << "   Could be negative due to resolution of Float_t so it will be set to a small positive value." << endl; 
       cout << "   mass2: " << values[kMass] << endl;
-      cout << "p1(p,x,y,z): " << t1->P() << ", " << t1->Px() << ", " << t1->Py() << ", " << t1->Pz() << endl;
-      cout << "p2(p,x,y,z): " << t2->P() << ", " << t2->Px() << ", " << t2->Py() << ", " << t2->Pz() << endl;
+      cout << "p1(p,x,y,z): " << p1 << ", " << px1 << ", " << py1 << ", " << pz1 << endl;
+      cout << "p2(p,x,y,z): " << p2 << ", " << px2 << ", " << py2 << ", " << pz2 << endl;
       values[kMass] = 0.0;
     }
     else
@@ -251,6 +251,8 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fnCuts(0),
   fiCut(0),
   fMoveParticleAccordingToVertex(kTRUE),
+  fUseCompactBGPool(kFALSE),
+  fNBinsEPCompactBGPool(1),
   fIsHeavyIon(0),
   fDoMesonAnalysis(kTRUE),
   fDoMesonQA(0),
@@ -459,6 +461,8 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fnCuts(0),
   fiCut(0),
   fMoveParticleAccordingToVertex(kTRUE),
+  fUseCompactBGPool(kFALSE),
+  fNBinsEPCompactBGPool(1),
   fIsHeavyIon(0),
   fDoMesonAnalysis(kTRUE),
   fDoMesonQA(0),
@@ -571,6 +575,7 @@ void AliAnalysisTaskGammaConvV1::InitBack(){
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                   0,8,5);
+        if(fUseCompactBGPool) fBGHandler[iCut]->SetUseCompactPool(kTRUE,fNBinsEPCompactBGPool);
         fBGHandlerRP[iCut] = NULL;
       } else {
         fBGHandlerRP[iCut] = new AliConversionAODBGHandlerRP(
@@ -3431,6 +3436,46 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
         }
       }
     }
+  } else if(fBGHandler[fiCut]->UsesCompactPool()){
+    // same mixing from the compact pool, the previous photons are set into a single photon object
+    Int_t epbin = fBGHandler[fiCut]->GetEPBinIndex(fEventPlaneAngle);
+    AliAODConversionPhoton previousGoodV0;
+    for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
+      AliGammaConversionAODBGHandler::GammaConversionCompactEvent previousEvent = fBGHandler[fiCut]->GetBGCompactEvent(zbin,mbin,epbin,nEventsInBG);
+      if(previousEvent.fNPhotons == 0) continue;
+
+      for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
+        AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+        for(Int_t iPrevious=0;iPrevious<previousEvent.fNPhotons;iPrevious++){
+          previousGoodV0.SetPxPyPzE(previousEvent.fPx[iPrevious],previousEvent.fPy[iPrevious],previousEvent.fPz[iPrevious],previousEvent.fE[iPrevious]);
+          Double_t conversionPoint[3] = {previousEvent.fConvX[iPrevious],previousEvent.fConvY[iPrevious],previousEvent.fConvZ[iPrevious]};
+          previousGoodV0.SetConversionPoint(conversionPoint);
+          previousGoodV0.SetPhotonQuality(previousEvent.fQuality[iPrevious]);
+
+          if(fMoveParticleAccordingToVertex == kTRUE){
+            MoveParticleAccordingToVertex(&previousGoodV0,previousEvent.fVertex);
+          }
+          if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
+            RotateParticleAccordingToEP(&previousGoodV0,previousEvent.fVertex->fEP,fEventPlaneAngle);
+          }
+
+          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
+          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+          if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
+            ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
+            if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
+            else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
+            if(fDoTHnSparse){
+              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+              if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
+              else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
+            }
+          }
+          delete backgroundCandidate;
+          backgroundCandidate = 0x0;
+        }
+      }
+    }
   } else {
     AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
 
@@ -71,6 +71,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     
     // BG HandlerSettings
     void SetMoveParticleAccordingToVertex(Bool_t flag)            {fMoveParticleAccordingToVertex = flag;}
+    void SetUseCompactBGPool(Bool_t flag, Int_t nBinsEP = 1)       {fUseCompactBGPool = flag; fNBinsEPCompactBGPool = nBinsEP;}
     void FillPhotonCombinatorialBackgroundHist(AliAODConversionPhoton *TruePhotonCandidate, Int_t pdgCode[], Double_t PhiParticle[]);
     void FillPhotonCombinatorialMothersHistESD(TParticle *daughter,TParticle *mother);
     void FillPhotonCombinatorialMothersHistAOD(AliAODMCParticle *daughter, AliAODMCParticle* motherCombPart);
@@ -286,6 +287,8 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     Int_t                             fnCuts;                                     //
     Int_t                             fiCut;                                      //
     Bool_t                            fMoveParticleAccordingToVertex;             //
+    Bool_t                            fUseCompactBGPool;                          // store only the mixing quantities of the BG photons
+    Int_t                             fNBinsEPCompactBGPool;                      // event plane bins of the compact BG pool
     Int_t                             fIsHeavyIon;                                //
     Bool_t                            fDoMesonAnalysis;                           //
     Int_t                             fDoMesonQA;                                 //
@@ -305,7 +308,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 40);
+    ClassDef(AliAnalysisTaskGammaConvV1, 41);
 };
 
 #endif
@@ -24,6 +24,7 @@
 #include "AliKFParticle.h"
 #include "AliAODConversionPhoton.h"
 #include "AliAODConversionMother.h"
+#include "TMath.h"
 
 using namespace std;
 
@@ -44,7 +45,10 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(),
 	fBGEventsENeg(),
-	fBGEventsMeson()
+	fBGEventsMeson(),
+	fUseCompactPool(kFALSE),
+	fNBinsEP(1),
+	fCompactBins()
 {
 	// constructor
 }
@@ -64,7 +68,10 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseCompactPool(kFALSE),
+	fNBinsEP(1),
+	fCompactBins()
 {
 	// constructor
 }
@@ -86,7 +93,10 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseCompactPool(kFALSE),
+	fNBinsEP(1),
+	fCompactBins()
 {
 	// constructor
     if(fNBinsZ>8) fNBinsZ = 8;
@@ -357,7 +367,10 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBinLimitsArrayMultiplicity(original.fBinLimitsArrayMultiplicity),
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
-	fBGEventsMeson(original.fBGEventsMeson)
+	fBGEventsMeson(original.fBGEventsMeson),
+	fUseCompactPool(original.fUseCompactPool),
+	fNBinsEP(original.fNBinsEP),
+	fCompactBins(original.fCompactBins)
 {
 	//copy constructor	
 }
@@ -568,6 +581,11 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	Int_t z = GetZBinIndex(zvalue);
 	Int_t m = GetMultiplicityBinIndex(multiplicity);
 
+	if(fUseCompactPool){
+		AddCompactEvent(eventGammas,xvalue,yvalue,zvalue,z,m,epvalue);
+		return;
+	}
+
 	if(fBGEventCounter[z][m] >= fNEvents){
 		fBGEventCounter[z][m]=0;
 	}
@@ -683,6 +701,119 @@ AliGammaConversionAODVector* AliGammaConversionAODBGHandler::GetBGGoodENeg(Int_t
 	return &(fBGEventsENeg[z][m][event]);
 }
 
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::SetUseCompactPool(Bool_t useCompactPool, Int_t nBinsEP){
+	// see header file for documentation
+	fUseCompactPool = useCompactPool;
+	fNBinsEP = nBinsEP > 0 ? nBinsEP : 1;
+
+	fCompactBins.clear();
+	if(!fUseCompactPool) return;
+
+	GammaConversionCompactBin emptyBin;
+	emptyBin.fCapacity = 0;
+	emptyBin.fCounter = 0;
+	emptyBin.fNPhotons.assign(fNEvents,0);
+	GammaConversionVertex noVertex = {0.,0.,0.,-100.};
+	emptyBin.fVertex.assign(fNEvents,noVertex);
+	fCompactBins.assign(fNBinsZ*fNBinsMultiplicity*fNBinsEP,emptyBin);
+}
+
+//_____________________________________________________________________________________________________________________________
+Int_t AliGammaConversionAODBGHandler::GetEPBinIndex(Double_t ep) const{
+	// event plane angle in [-pi,pi) shifted by pi to [0,pi) (second harmonic), 
+	// events without event plane (-100) go to the first bin
+	if(fNBinsEP <= 1 || ep < -TMath::Pi()) return 0;
+	Double_t f = ep < 0 ? ep + TMath::Pi() : ep;
+	Int_t epbin = (Int_t)(f/TMath::Pi()*fNBinsEP);
+	return epbin < fNBinsEP ? epbin : fNBinsEP-1;
+}
+
+//_____________________________________________________________________________________________________________________________
+template <class T> static void RepackCompactArray(vector<T> &array, const vector<Int_t> &nPerSlot, Int_t oldCapacity, Int_t newCapacity){
+	// move the entries of each event slot to the slot layout of the new capacity
+	vector<T> repacked(nPerSlot.size()*newCapacity);
+	for(UInt_t slot=0;slot<nPerSlot.size();slot++){
+		for(Int_t i=0;i<nPerSlot[slot];i++){
+			repacked[slot*newCapacity+i] = array[slot*oldCapacity+i];
+		}
+	}
+	array.swap(repacked);
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::ResizeCompactBin(GammaConversionCompactBin &bin, Int_t capacity){
+	// the capacity only grows, it follows the largest photon multiplicity seen in the bin
+	RepackCompactArray(bin.fPx,bin.fNPhotons,bin.fCapacity,capacity);
+	RepackCompactArray(bin.fPy,bin.fNPhotons,bin.fCapacity,capacity);
+	RepackCompactArray(bin.fPz,bin.fNPhotons,bin.fCapacity,capacity);
+	RepackCompactArray(bin.fE,bin.fNPhotons,bin.fCapacity,capacity);
+	RepackCompactArray(bin.fConvX,bin.fNPhotons,bin.fCapacity,capacity);
+	RepackCompactArray(bin.fConvY,bin.fNPhotons,bin.fCapacity,capacity);
+	RepackCompactArray(bin.fConvZ,bin.fNPhotons,bin.fCapacity,capacity);
+	RepackCompactArray(bin.fQuality,bin.fNPhotons,bin.fCapacity,capacity);
+	bin.fCapacity = capacity;
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::AddCompactEvent(TList* const eventGammas, Double_t xvalue, Double_t yvalue, Double_t zvalue, Int_t zbin, Int_t mbin, Double_t epvalue){
+	// copy the photons of the event into the next slot of the ring of its bin
+
+	GammaConversionCompactBin &bin = fCompactBins[(zbin*fNBinsMultiplicity+mbin)*fNBinsEP+GetEPBinIndex(epvalue)];
+
+	if(bin.fCounter >= fNEvents){
+		bin.fCounter = 0;
+	}
+	Int_t slot = bin.fCounter;
+
+	bin.fVertex[slot].fX = xvalue;
+	bin.fVertex[slot].fY = yvalue;
+	bin.fVertex[slot].fZ = zvalue;
+	bin.fVertex[slot].fEP = epvalue;
+
+	Int_t nPhotons = eventGammas->GetEntries();
+	bin.fNPhotons[slot] = 0;
+	if(nPhotons > bin.fCapacity) ResizeCompactBin(bin,nPhotons);
+
+	Int_t offset = slot*bin.fCapacity;
+	for(Int_t i=0;i<nPhotons;i++){
+		AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)(eventGammas->At(i));
+		bin.fPx[offset+i] = gamma->Px();
+		bin.fPy[offset+i] = gamma->Py();
+		bin.fPz[offset+i] = gamma->Pz();
+		bin.fE[offset+i] = gamma->E();
+		bin.fConvX[offset+i] = gamma->GetConversionX();
+		bin.fConvY[offset+i] = gamma->GetConversionY();
+		bin.fConvZ[offset+i] = gamma->GetConversionZ();
+		bin.fQuality[offset+i] = gamma->GetPhotonQuality();
+	}
+	bin.fNPhotons[slot] = nPhotons;
+	bin.fCounter++;
+}
+
+//_____________________________________________________________________________________________________________________________
+AliGammaConversionAODBGHandler::GammaConversionCompactEvent AliGammaConversionAODBGHandler::GetBGCompactEvent(Int_t zbin, Int_t mbin, Int_t epbin, Int_t event) const{
+	// see header file for documentation
+	GammaConversionCompactEvent view = {0,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL};
+	if(!fUseCompactPool) return view;
+
+	const GammaConversionCompactBin &bin = fCompactBins[(zbin*fNBinsMultiplicity+mbin)*fNBinsEP+epbin];
+	view.fVertex = &bin.fVertex[event];
+	view.fNPhotons = bin.fNPhotons[event];
+	if(view.fNPhotons == 0) return view;
+
+	Int_t offset = event*bin.fCapacity;
+	view.fPx = &bin.fPx[offset];
+	view.fPy = &bin.fPy[offset];
+	view.fPz = &bin.fPz[offset];
+	view.fE = &bin.fE[offset];
+	view.fConvX = &bin.fConvX[offset];
+	view.fConvY = &bin.fConvY[offset];
+	view.fConvZ = &bin.fConvZ[offset];
+	view.fQuality = &bin.fQuality[offset];
+	return view;
+}
+
 //_____________________________________________________________________________________________________________________________
 void AliGammaConversionAODBGHandler::PrintBGArray(){
 	//see headerfile for documentation
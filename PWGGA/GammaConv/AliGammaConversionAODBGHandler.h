@@ -40,6 +40,20 @@ class AliGammaConversionAODBGHandler : public TObject {
 	
 	typedef struct GammaConversionVertex GammaConversionVertex; 																//!
 
+	// view on one event of the compact photon pool, the arrays have fNPhotons entries
+	struct GammaConversionCompactEvent{
+		Int_t 							fNPhotons;
+		const Double_t*					fPx;
+		const Double_t*					fPy;
+		const Double_t*					fPz;
+		const Double_t*					fE;
+		const Double_t*					fConvX;
+		const Double_t*					fConvY;
+		const Double_t*					fConvZ;
+		const UChar_t*					fQuality;
+		const GammaConversionVertex*	fVertex;
+	};
+
 	typedef vector<AliGammaConversionAODVector> AliGammaConversionBGEventVector;
 	typedef vector<AliGammaConversionBGEventVector> AliGammaConversionMultipicityVector;
 	typedef vector<AliGammaConversionMultipicityVector> AliGammaConversionBGVector;
@@ -80,8 +94,40 @@ class AliGammaConversionAODBGHandler : public TObject {
 
 	Double_t GetBGProb(Int_t z, Int_t m){return fBGProbability[z][m];}
 
+	// Compact photon pool: instead of full AliAODConversionPhoton copies, only the four-momentum,
+	// the conversion point and the photon quality (all what is needed to build the background
+	// mothers) are stored, in contiguous arrays per (z, multiplicity, event plane) bin holding
+	// a ring of fNEvents events. The photons are then read with GetBGCompactEvent,
+	// GetBGGoodV0s returns empty events. Optionally the pool is binned in nBinsEP bins of the
+	// event plane angle in [0,pi), to be called after the z and multiplicity binning is set.
+	void SetUseCompactPool(Bool_t useCompactPool, Int_t nBinsEP = 1);
+	Bool_t UsesCompactPool() const {return fUseCompactPool;}
+	Int_t GetNBinsEP() const {return fNBinsEP;}
+	Int_t GetEPBinIndex(Double_t ep) const;
+	GammaConversionCompactEvent GetBGCompactEvent(Int_t zbin, Int_t mbin, Int_t epbin, Int_t event) const;
+
 	private:
 
+		// photons of the ring of events of one bin of the compact pool, event slot i
+		// uses the entries [i*fCapacity, i*fCapacity+fNPhotons[i]) of the photon arrays
+		struct GammaConversionCompactBin{
+			Int_t 							fCapacity;	// photons per event slot
+			Int_t 							fCounter;	// next event slot to fill
+			vector<Int_t> 					fNPhotons;	// photons per event slot
+			vector<GammaConversionVertex> 	fVertex;	// vertex per event slot
+			vector<Double_t> 				fPx;
+			vector<Double_t> 				fPy;
+			vector<Double_t> 				fPz;
+			vector<Double_t> 				fE;
+			vector<Double_t> 				fConvX;
+			vector<Double_t> 				fConvY;
+			vector<Double_t> 				fConvZ;
+			vector<UChar_t> 				fQuality;
+		};
+
+		void AddCompactEvent(TList* const eventGammas, Double_t xvalue, Double_t yvalue, Double_t zvalue, Int_t zbin, Int_t mbin, Double_t epvalue);
+		void ResizeCompactBin(GammaConversionCompactBin &bin, Int_t capacity);
+
 		Int_t 								fNEvents; 						// number of events
 		Int_t ** 							fBGEventCounter;				//! bg counter
 		Int_t ** 							fBGEventENegCounter;			//! bg electron counter
@@ -95,7 +141,10 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEvents; 						// photon background events
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector 	fBGEventsMeson; 				// neutral meson background events
+		Bool_t								fUseCompactPool;				// store the photons in the compact pool
+		Int_t								fNBinsEP;						// n bins event plane of the compact pool
+		vector<GammaConversionCompactBin>	fCompactBins;					//! compact pool, index (z*nM+m)*nEP+ep
 		
-	ClassDef(AliGammaConversionAODBGHandler,5)
+	ClassDef(AliGammaConversionAODBGHandler,6)
 };
 #endif
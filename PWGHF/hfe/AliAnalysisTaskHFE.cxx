@@ -165,6 +165,7 @@ AliAnalysisTaskSE("PID efficiency Analysis")
   memset(fBinLimit, 0, sizeof(Double_t) * (kBgPtBins+1));
   memset(&fisppMultiBin, kFALSE, sizeof(fisppMultiBin));
   memset(fCentralityLimits, 0, sizeof(Float_t) * 12);
+  for(Int_t icont = 0; icont < kNtrackContainers; icont++) fContainerID[icont] = -1;
 
   SetppAnalysis();
 }
@@ -255,6 +256,7 @@ AliAnalysisTaskHFE::AliAnalysisTaskHFE(const char * name):
   memset(fBinLimit, 0, sizeof(Double_t) * (kBgPtBins+1));
   memset(&fisppMultiBin, kFALSE, sizeof(fisppMultiBin));
   memset(fCentralityLimits, 0, sizeof(Float_t) * 12);
+  for(Int_t icont = 0; icont < kNtrackContainers; icont++) fContainerID[icont] = -1;
 
   SetppAnalysis();
 }
@@ -378,6 +380,7 @@ void AliAnalysisTaskHFE::Copy(TObject &o) const {
   target.fWeightBackGround = fWeightBackGround;
   target.fVz = fVz;
   target.fContainer = fContainer;
+  memcpy(target.fContainerID, fContainerID, sizeof(Int_t) * kNtrackContainers);
   target.fVarManager = fVarManager;
   target.fSignalCuts = fSignalCuts;
   target.fCFM = fCFM;
@@ -1118,19 +1121,22 @@ void AliAnalysisTaskHFE::ProcessESD(){
 
     if(fFillNoCuts) {
       if(signal || !fFillSignalOnly){
-        fVarManager->FillContainer(fContainer, "recTrackContReco", AliHFEcuts::kStepRecNoCut, kFALSE);
-        fVarManager->FillContainer(fContainer, "recTrackContMC", AliHFEcuts::kStepRecNoCut, kTRUE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContReco], AliHFEcuts::kStepRecNoCut, kFALSE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContMC], AliHFEcuts::kStepRecNoCut, kTRUE);
       }
     }
   
+    // Reconstructed track cut steps, checked at once
+    UInt_t recCutMask = CheckRecTrackCuts(track, fRejectKinkMother && track->GetKinkIndex(0) != 0);
+
     // RecKine: ITSTPC cuts  
-    if(!ProcessCutStep(AliHFEcuts::kStepRecKineITSTPC, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepRecKineITSTPC, recCutMask)) continue;
     
     fQACollection->Fill("Kinkbefore", track->Pt(), kinkstatus); 
     // RecPrim
     if(fRejectKinkMother) { 
       if(track->GetKinkIndex(0) != 0) continue; } // Quick and dirty fix to reject both kink mothers and daughters
-    if(!ProcessCutStep(AliHFEcuts::kStepRecPrim, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepRecPrim, recCutMask)) continue;
     fQACollection->Fill("Kinkafter", track->Pt(), kinkstatus); 
 
     // production radius
@@ -1159,7 +1165,7 @@ void AliAnalysisTaskHFE::ProcessESD(){
     }
 
     // HFEcuts: ITS layers cuts
-    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsITS, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsITS, recCutMask)) continue;
   
     // production vertex
     if(fill)  {
@@ -1168,13 +1174,13 @@ void AliAnalysisTaskHFE::ProcessESD(){
     }
   
     // HFE cuts: TOF PID and mismatch flag
-    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTOF, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTOF, recCutMask)) continue;
 
     // HFE cuts: TPC PID cleanup
-    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTPC, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTPC, recCutMask)) continue;
 
     // HFEcuts: Nb of tracklets TRD0
-    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTRD, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTRD, recCutMask)) continue;
 
     // Fill correlation maps before PID
     if(signal && fContainer->GetCorrelationMatrix("correlationstepbeforePID")) {
@@ -1392,8 +1398,8 @@ void AliAnalysisTaskHFE::ProcessESD(){
     if(GetPlugin(kSecVtx)) {
       AliDebug(2, "Running Secondary Vertex Analysis");
       if(fSecVtx->Process(track) && signal) {
-        fVarManager->FillContainer(fContainer, "recTrackContSecvtxReco", AliHFEcuts::kStepHFEcutsSecvtx, kFALSE);
-        fVarManager->FillContainer(fContainer, "recTrackContSecvtxMC", AliHFEcuts::kStepHFEcutsSecvtx, kTRUE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContSecvtxReco], AliHFEcuts::kStepHFEcutsSecvtx, kFALSE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContSecvtxMC], AliHFEcuts::kStepHFEcutsSecvtx, kTRUE);
         bTagged=kTRUE;
       }
     }
@@ -1540,8 +1546,8 @@ void AliAnalysisTaskHFE::ProcessESD(){
         }
       }
       if(signal) {
-        fVarManager->FillContainer(fContainer, "recTrackContDEReco", AliHFEcuts::kStepHFEcutsDca, kFALSE);
-        fVarManager->FillContainer(fContainer, "recTrackContDEMC", AliHFEcuts::kStepHFEcutsDca, kTRUE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContDEReco], AliHFEcuts::kStepHFEcutsDca, kFALSE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContDEMC], AliHFEcuts::kStepHFEcutsDca, kTRUE);
         fVarManager->FillCorrelationMatrix(fContainer->GetCorrelationMatrix("correlationstepafterDE"));
       }
       if(HasMCData()){
@@ -1728,8 +1734,8 @@ void AliAnalysisTaskHFE::ProcessAOD(){
     
     if(fFillNoCuts) {
       if(signal || !fFillSignalOnly){
-        fVarManager->FillContainer(fContainer, "recTrackContReco", AliHFEcuts::kStepRecNoCut, kFALSE);
-        fVarManager->FillContainer(fContainer, "recTrackContMC", AliHFEcuts::kStepRecNoCut, kTRUE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContReco], AliHFEcuts::kStepRecNoCut, kFALSE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContMC], AliHFEcuts::kStepRecNoCut, kTRUE);
       }
     }
 
@@ -1742,8 +1748,11 @@ void AliAnalysisTaskHFE::ProcessAOD(){
       }
     }
 
+    // Reconstructed track cut steps, checked at once
+    UInt_t recCutMask = CheckRecTrackCuts(track, fRejectKinkMother && kinkmother);
+
     // RecKine: ITSTPC cuts  
-    if(!ProcessCutStep(AliHFEcuts::kStepRecKineITSTPC, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepRecKineITSTPC, recCutMask)) continue;
 
     fQACollection->Fill("Kinkbefore", track->Pt(), kinkstatus); 
     // Reject kink mother
@@ -1759,7 +1768,7 @@ void AliAnalysisTaskHFE::ProcessAOD(){
     }       
 
     // RecPrim
-    if(!ProcessCutStep(AliHFEcuts::kStepRecPrim, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepRecPrim, recCutMask)) continue;
     fQACollection->Fill("Kinkafter", track->Pt(), kinkstatus); 
 
     // production radius
@@ -1784,19 +1793,19 @@ void AliAnalysisTaskHFE::ProcessAOD(){
     }
 
     // HFEcuts: ITS layers cuts
-    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsITS, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsITS, recCutMask)) continue;
 
     // production radius
     if(fill) fQACollection->Fill("RadiusAfter", pradius); 
       
     // HFE cuts: TOF PID and mismatch flag
-    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTOF, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTOF, recCutMask)) continue;
       
     // HFE cuts: TPC PID cleanup
-    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTPC, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTPC, recCutMask)) continue;
     
     // HFEcuts: Nb of tracklets TRD0
-    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTRD, track)) continue;
+    if(!ProcessCutStep(AliHFEcuts::kStepHFEcutsTRD, recCutMask)) continue;
 
     // Fill correlation maps before PID
     if(signal && fContainer->GetCorrelationMatrix("correlationstepbeforePID")) {
@@ -1965,8 +1974,8 @@ void AliAnalysisTaskHFE::ProcessAOD(){
               fVarManager->FillContainer(fContainer, "hadronicBackground", 2, kFALSE, fWeightBackGround);
         }
 
-        fVarManager->FillContainer(fContainer, "recTrackContDEReco", AliHFEcuts::kStepHFEcutsDca, kFALSE);
-        fVarManager->FillContainer(fContainer, "recTrackContDEMC", AliHFEcuts::kStepHFEcutsDca, kTRUE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContDEReco], AliHFEcuts::kStepHFEcutsDca, kFALSE);
+        fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContDEMC], AliHFEcuts::kStepHFEcutsDca, kTRUE);
         fVarManager->FillCorrelationMatrix(fContainer->GetCorrelationMatrix("correlationstepafterDE"));
       }
     }
@@ -2029,20 +2038,20 @@ Bool_t AliAnalysisTaskHFE::ProcessMCtrack(AliVParticle *track){
   //printf("MC Generated\n");
   if(!fCFM->CheckParticleCuts(AliHFEcuts::kStepMCGenerated, track)) return kFALSE;
   //printf("MC Generated pass\n");
-  fVarManager->FillContainer(fContainer, "MCTrackCont", AliHFEcuts::kStepMCGenerated, kFALSE);
+  fVarManager->FillContainer(fContainer, fContainerID[kMCTrackCont], AliHFEcuts::kStepMCGenerated, kFALSE);
 
   // Step GeneratedZOutNoPileUp
   if((fIdentifiedAsPileUp) || (TMath::Abs(fVz) > fCuts->GetVertexRange()) || (fCentralityF < 0)) return kFALSE;
-  fVarManager->FillContainer(fContainer, "MCTrackCont", AliHFEcuts::kStepMCGeneratedZOutNoPileUpCentralityFine, kFALSE);
+  fVarManager->FillContainer(fContainer, fContainerID[kMCTrackCont], AliHFEcuts::kStepMCGeneratedZOutNoPileUpCentralityFine, kFALSE);
   //printf("In ProcessMCtrack %f\n",fCentralityF);
 
   // Step Generated Event Cut
   if(!fPassTheEventCut) return kFALSE;
-  fVarManager->FillContainer(fContainer, "MCTrackCont", AliHFEcuts::kStepMCGeneratedEventCut, kFALSE);
+  fVarManager->FillContainer(fContainer, fContainerID[kMCTrackCont], AliHFEcuts::kStepMCGeneratedEventCut, kFALSE);
 
   if(IsESDanalysis()){
     if(!fCFM->CheckParticleCuts(AliHFEcuts::kStepMCInAcceptance, track)) return kFALSE;
-    fVarManager->FillContainer(fContainer, "MCTrackCont", AliHFEcuts::kStepMCInAcceptance, kFALSE);
+    fVarManager->FillContainer(fContainer, fContainerID[kMCTrackCont], AliHFEcuts::kStepMCInAcceptance, kFALSE);
   }
   return kTRUE;
 }
@@ -2169,6 +2178,11 @@ void AliAnalysisTaskHFE::MakeParticleContainer(){
     fContainer->SetStepTitle("recTrackContReco", fPID->SortedDetectorName(ipid), AliHFEcuts::kNcutStepsRecTrack + ipid);
     fContainer->SetStepTitle("recTrackContMC", fPID->SortedDetectorName(ipid), AliHFEcuts::kNcutStepsRecTrack + ipid);
   }
+
+  // Resolve the track containers once, they are filled by handle in the event loop
+  const Char_t *trackContainerName[kNtrackContainers] = {"MCTrackCont", "recTrackContReco", "recTrackContMC", "recTrackContDEReco", "recTrackContDEMC", "recTrackContSecvtxReco", "recTrackContSecvtxMC"};
+  for(Int_t icont = 0; icont < kNtrackContainers; icont++)
+    fContainerID[icont] = fContainer->GetContainerID(trackContainerName[icont]);
 }
 //____________________________________________________________
 void AliAnalysisTaskHFE::InitContaminationQA(){
@@ -2370,16 +2384,28 @@ void AliAnalysisTaskHFE::SwitchOnPlugin(Int_t plug){
   };
 }
 //__________________________________________
-Bool_t AliAnalysisTaskHFE::ProcessCutStep(Int_t cutStep, AliVParticle *track){
+UInt_t AliAnalysisTaskHFE::CheckRecTrackCuts(AliVParticle *track, Bool_t kinkRejected) const {
   //
-  // Check single track cuts for a given cut step
-  // Fill the particle container
+  // Check the single track cuts of all reconstructed track steps at once,
+  // stopping at the first failed step. Bit (step - kStepRecKineITSTPC) is set
+  // if the track passes the step. Tracks rejected as kinks after the first 
+  // step are only checked for that step
   //
   const Int_t kMCOffset = AliHFEcuts::kNcutStepsMCTrack;
-  if(!fCFM->CheckParticleCuts(cutStep + kMCOffset, track)) return kFALSE;
+  Int_t lastStep = kinkRejected ? AliHFEcuts::kStepRecPrim : AliHFEcuts::kNcutStepsRecTrack;
+  return fCFM->CheckParticleCutsMask(track, AliHFEcuts::kStepRecKineITSTPC + kMCOffset, lastStep + kMCOffset, kTRUE);
+}
+//__________________________________________
+Bool_t AliAnalysisTaskHFE::ProcessCutStep(Int_t cutStep, UInt_t recCutMask){
+  //
+  // Check single track cuts for a given cut step in the mask 
+  // from CheckRecTrackCuts
+  // Fill the particle container
+  //
+  if(!TESTBIT(recCutMask, cutStep - AliHFEcuts::kStepRecKineITSTPC)) return kFALSE;
   if(fVarManager->IsSignalTrack()) {
-    fVarManager->FillContainer(fContainer, "recTrackContReco", cutStep, kFALSE);
-    fVarManager->FillContainer(fContainer, "recTrackContMC", cutStep, kTRUE);
+    fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContReco], cutStep, kFALSE);
+    fVarManager->FillContainer(fContainer, fContainerID[kRecTrackContMC], cutStep, kTRUE);
   }
   return kTRUE;
 }
@@ -82,6 +82,16 @@ class AliAnalysisTaskHFE : public AliAnalysisTaskSE{
       kGammaConv = 2,
       kOther = 3
     };
+    enum{
+      kMCTrackCont = 0,
+      kRecTrackContReco = 1,
+      kRecTrackContMC = 2,
+      kRecTrackContDEReco = 3,
+      kRecTrackContDEMC = 4,
+      kRecTrackContSecvtxReco = 5,
+      kRecTrackContSecvtxMC = 6,
+      kNtrackContainers = 7
+    };
     enum{
       kBgPtBins = 44,
       kElecBgSpecies = 9,
@@ -214,7 +224,8 @@ class AliAnalysisTaskHFE : public AliAnalysisTaskSE{
 
     Bool_t PreSelectTrack(AliESDtrack *track) const;
     Bool_t ProcessMCtrack(AliVParticle *track);
-    Bool_t ProcessCutStep(Int_t cutStep, AliVParticle *track);
+    UInt_t CheckRecTrackCuts(AliVParticle *track, Bool_t kinkRejected) const;
+    Bool_t ProcessCutStep(Int_t cutStep, UInt_t recCutMask);
     AliAODMCHeader *fAODMCHeader;         // ! MC info AOD
     TClonesArray *fAODArrayMCInfo;        // ! MC info particle AOD
     ULong_t fQAlevel;                     // QA level
@@ -250,6 +261,7 @@ class AliAnalysisTaskHFE : public AliAnalysisTaskSE{
     Double_t fBinLimit[kBgPtBins+1];      // Electron pt bin edges
     Float_t fCentralityLimits[12];        // Limits for centrality bins
     AliHFEcontainer *fContainer;          //! The HFE container
+    Int_t fContainerID[kNtrackContainers];//! Handles of the track containers in fContainer
     AliHFEvarManager *fVarManager;        // The var manager as the backbone of the analysis
     AliHFEsignalCuts *fSignalCuts;        //! MC true signal (electron coming from certain source) 
     AliCFManager *fCFM;                   //! Correction Framework Manager
@@ -608,6 +608,7 @@ void AliAnalysisTaskHFEpACorrelation::UserCreateOutputObjects()
     fPIDqa->Initialize(fPID);
     
     fNonHFE = new AliSelectNonHFE();
+    fNonHFE->SetPartnerPreselection(kTRUE); //partner cuts are the same for all the electrons of an event
     //______________________________________________________________________
     
     
@@ -1587,6 +1588,11 @@ void AliAnalysisTaskHFEpACorrelation::UserExec(Option_t *)
     
     //______________________________________________________________________
     
+    ///_____________________________________________________________________
+    ///Non-HFE partners, selected once for all the electrons of the event
+    SetNonHFECuts();
+    fNonHFE->PreselectPartners(fVevent);
+    
     ///_____________________________________________________________________
     ///Track loop
     Int_t NTracks=0;
@@ -1943,34 +1949,11 @@ Bool_t AliAnalysisTaskHFEpACorrelation::ProcessCutStep(Int_t cutStep, AliVPartic
 //______________________________________________________________________
 
 //______________________________________________________________________
-void AliAnalysisTaskHFEpACorrelation::ElectronHadronCorrelation(AliVTrack *track, Int_t trackIndex, AliVParticle *vtrack)
+void AliAnalysisTaskHFEpACorrelation::SetNonHFECuts()
 {
-    
-    ///_________________________________________________________________
-    ///MC analysis
-    Bool_t lIsNHFe = kFALSE;
-    Bool_t lIsHFe = kFALSE;
-    Bool_t lIsOther = kFALSE;
-    Bool_t lHasMother = kFALSE;
-    
-    //Electron Information
-    Double_t fPhiE = -999;
-    Double_t fEtaE = -999;
-    Double_t fPhiH = -999;
-    Double_t fEtaH = -999;
-    Double_t fDphi = -999;
-    Double_t fDeta = -999;
-    Double_t fPtE = -999;
-    Double_t fPtH = -999;
-    
-    Double_t pi = TMath::Pi();
-    
-    fPhiE = track->Phi();
-    fEtaE = track->Eta();
-    fPtE = track->Pt();
-    
-    
-    ///_________________________________________________________________
+    //
+    // Partner cuts of the Non-HFE reconstruction, the same for all the electrons of the event
+    //
     
     //________________________________________________
     //Associated particle cut
@@ -2012,6 +1995,37 @@ void AliAnalysisTaskHFEpACorrelation::ElectronHadronCorrelation(AliVTrack *track
     fNonHFE->SetHistAngle(fOpAngle);
     fNonHFE->SetHistDCABack(fDCABack);
     fNonHFE->SetHistDCA(fDCA);
+}
+
+//______________________________________________________________________
+void AliAnalysisTaskHFEpACorrelation::ElectronHadronCorrelation(AliVTrack *track, Int_t trackIndex, AliVParticle *vtrack)
+{
+    
+    ///_________________________________________________________________
+    ///MC analysis
+    Bool_t lIsNHFe = kFALSE;
+    Bool_t lIsHFe = kFALSE;
+    Bool_t lIsOther = kFALSE;
+    Bool_t lHasMother = kFALSE;
+    
+    //Electron Information
+    Double_t fPhiE = -999;
+    Double_t fEtaE = -999;
+    Double_t fPhiH = -999;
+    Double_t fEtaH = -999;
+    Double_t fDphi = -999;
+    Double_t fDeta = -999;
+    Double_t fPtE = -999;
+    Double_t fPtH = -999;
+    
+    Double_t pi = TMath::Pi();
+    
+    fPhiE = track->Phi();
+    fEtaE = track->Eta();
+    fPtE = track->Pt();
+    
+    
+    ///_________________________________________________________________
     
     //"SetHistMassBack" sets the LS histogram in the invariant mass
     //"SetHistMass" sets the ULS histogram in the invariant mass
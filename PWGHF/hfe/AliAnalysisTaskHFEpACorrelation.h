@@ -133,6 +133,8 @@ private:
     
     //Function to process track cuts
     Bool_t ProcessCutStep(Int_t cutStep, AliVParticle *track);
+    //Function to set the partner cuts of the non-HFE reconstruction
+    void SetNonHFECuts();
     //Function to process eh analysis
     void ElectronHadronCorrelation(AliVTrack *track, Int_t trackIndex, AliVParticle *vtrack);
     //Function to find non-HFE and fill histos
@@ -43,6 +43,7 @@ ClassImp(AliHFEcontainer::AliHFEvarInfo)
 AliHFEcontainer::AliHFEcontainer():
   TNamed("HFEcontainer", ""),
   fContainers(NULL),
+  fContainerHandles(NULL),
   fCorrelationMatrices(NULL),
   fVariables(NULL),
   fNVars(0),
@@ -57,6 +58,7 @@ AliHFEcontainer::AliHFEcontainer():
 AliHFEcontainer::AliHFEcontainer(const Char_t *name):
   TNamed(name, ""),
   fContainers(NULL),
+  fContainerHandles(NULL),
   fCorrelationMatrices(NULL),
   fVariables(NULL),
   fNVars(0),
@@ -73,6 +75,7 @@ AliHFEcontainer::AliHFEcontainer(const Char_t *name):
 AliHFEcontainer::AliHFEcontainer(const Char_t *name, UInt_t nVar):
   TNamed(name, ""),
   fContainers(NULL),
+  fContainerHandles(NULL),
   fCorrelationMatrices(NULL),
   fVariables(NULL),
   fNVars(0),
@@ -91,6 +94,7 @@ AliHFEcontainer::AliHFEcontainer(const Char_t *name, UInt_t nVar):
 AliHFEcontainer::AliHFEcontainer(const AliHFEcontainer &ref):
   TNamed(ref),
   fContainers(NULL),
+  fContainerHandles(NULL),
   fCorrelationMatrices(NULL),
   fVariables(NULL),
   fNVars(ref.fNVars),
@@ -137,6 +141,7 @@ AliHFEcontainer &AliHFEcontainer::operator=(const AliHFEcontainer &ref){
   this->~AliHFEcontainer(); // cleanup old object before creating the new onwe
   TNamed::operator=(ref);
   fContainers = new THashList();
+  fContainerHandles = NULL;
   fCorrelationMatrices = NULL;
   fNVars = ref.fNVars;
   if(fNVars){
@@ -178,6 +183,7 @@ AliHFEcontainer::~AliHFEcontainer(){
   // Destructor
   //
   delete fContainers;
+  if(fContainerHandles) delete fContainerHandles;
   if(fCorrelationMatrices) delete fCorrelationMatrices;
   if(fVariables){
     fVariables->Delete();
@@ -307,6 +313,61 @@ AliCFContainer *AliHFEcontainer::GetCFContainer(const Char_t *name) const{
   return dynamic_cast<AliCFContainer *>(fContainers->FindObject(name));
 }
 
+//__________________________________________________________________
+AliCFContainer *AliHFEcontainer::GetCFContainer(Int_t contID) const{
+  //
+  // Find a container by the handle obtained from GetContainerID
+  //
+  if(!fContainerHandles || contID < 0 || contID >= fContainerHandles->GetEntriesFast()) return NULL;
+  return static_cast<AliCFContainer *>(fContainerHandles->UncheckedAt(contID));
+}
+
+//__________________________________________________________________
+Int_t AliHFEcontainer::GetContainerID(const Char_t *name){
+  //
+  // Get a handle for the container with the given name, to be used in
+  // place of the name in the event loop. Handles are only valid for this
+  // object, they are neither copied nor streamed.
+  // Returns -1 if the container does not exist
+  //
+  AliCFContainer *cont = GetCFContainer(name);
+  if(!cont){
+    AliDebug(1, Form("Container %s not found", name));
+    return -1;
+  }
+  if(!fContainerHandles) fContainerHandles = new TObjArray;
+  Int_t contID = fContainerHandles->IndexOf(cont);
+  if(contID < 0){
+    fContainerHandles->AddLast(cont);
+    contID = fContainerHandles->GetEntriesFast() - 1;
+  }
+  return contID;
+}
+
+//__________________________________________________________________
+Int_t AliHFEcontainer::GetStepID(Int_t contID, const Char_t *steptitle) const{
+  //
+  // Get the step with the given title in the container with handle contID,
+  // to be used with FillCFContainer(contID, step, ...)
+  // Returns -1 if the step does not exist
+  //
+  AliCFContainer *cont = GetCFContainer(contID);
+  if(!cont) return -1;
+  return FindStep(cont, steptitle);
+}
+
+//__________________________________________________________________
+Int_t AliHFEcontainer::FindStep(const AliCFContainer *const cont, const Char_t *steptitle) const{
+  //
+  // find the matching step title
+  //
+  for(Int_t istep = 0; istep < cont->GetNStep(); istep++){
+    TString tstept = cont->GetStepTitle(istep);
+    if(!tstept.CompareTo(steptitle)) return istep;
+  }
+  return -1;
+}
+
 //__________________________________________________________________
 THnSparseF *AliHFEcontainer::GetCorrelationMatrix(const Char_t *name) const{
   //
@@ -327,6 +388,16 @@ void AliHFEcontainer::FillCFContainer(const Char_t *name, UInt_t step, const Dou
   cont->Fill(content, step, weight);
 }
 
+//__________________________________________________________________
+void AliHFEcontainer::FillCFContainer(Int_t contID, UInt_t step, const Double_t * const content, Double_t weight) const {
+  //
+  // Fill container by handle, see GetContainerID and GetStepID
+  //
+  AliCFContainer *cont = GetCFContainer(contID);
+  if(!cont || step >= static_cast<UInt_t>(cont->GetNStep())) return;
+  cont->Fill(content, step, weight);
+}
+
 //__________________________________________________________________
 void AliHFEcontainer::FillCFContainerStepname(const Char_t *name, const Char_t *steptitle, const Double_t * const content, Double_t weight)const{
   //
@@ -334,15 +405,7 @@ void AliHFEcontainer::FillCFContainerStepname(const Char_t *name, const Char_t *
   //
   AliCFContainer *cont = GetCFContainer(name);
   if(!cont) return;
-  // find the matching step title
-  Int_t mystep = -1;
-  for(Int_t istep = 0; istep < cont->GetNStep(); istep++){
-    TString tstept = cont->GetStepTitle(istep);
-    if(!tstept.CompareTo(steptitle)){
-      mystep = istep;
-      break;
-    }
-  }
+  Int_t mystep = FindStep(cont, steptitle);
   if(mystep < 0){
     // step not found
     AliDebug(1, Form("Step %s not found in container %s", steptitle, name));
@@ -56,9 +56,13 @@ class AliHFEcontainer : public TNamed{
     void CreateContainer(const Char_t *name, const Char_t *title, UInt_t nStep);
     void CreateCorrelationMatrix(const Char_t *name, const Char_t *title);
     AliCFContainer *GetCFContainer(const Char_t *name) const;
+    AliCFContainer *GetCFContainer(Int_t contID) const;
+    Int_t GetContainerID(const Char_t *name);
+    Int_t GetStepID(Int_t contID, const Char_t *steptitle) const;
     THnSparseF *GetCorrelationMatrix(const Char_t *name) const;
     THashList *GetListOfCorrelationMatrices() const { return fCorrelationMatrices; }
     void FillCFContainer(const Char_t *name, UInt_t step, const Double_t * const content, Double_t weight = 1.) const;
+    void FillCFContainer(Int_t contID, UInt_t step, const Double_t * const content, Double_t weight = 1.) const;
     void FillCFContainerStepname(const Char_t *name, const Char_t *step, const Double_t *const content, Double_t weight = 1.) const;
     AliCFContainer *MakeMergedCFContainer(const Char_t *name, const Char_t *title, const Char_t *contnames) const;
 
@@ -97,7 +101,10 @@ class AliHFEcontainer : public TNamed{
     };
 
   private:
+    Int_t FindStep(const AliCFContainer *const cont, const Char_t *steptitle) const;
+
     THashList *fContainers;     // TObjArray for Containers
+    TObjArray *fContainerHandles; //! Containers by handle, not owned
     THashList *fCorrelationMatrices; // Container for Correlation Matrices
     TObjArray *fVariables;      // Variable Information
     UInt_t fNVars;              // Number of Variables
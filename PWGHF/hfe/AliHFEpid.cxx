@@ -67,6 +67,10 @@ AliHFEpid::AliHFEpid():
   fEnabledDetectors(0),
   fNPIDdetectors(0),
   fVarManager(NULL),
+  fHandleContainer(NULL),
+  fHandleContname(),
+  fRecContainerID(-1),
+  fMCContainerID(-1),
   fCommonObjects(NULL)
 {
   //
@@ -83,6 +87,10 @@ AliHFEpid::AliHFEpid(const Char_t *name):
   fEnabledDetectors(0),
   fNPIDdetectors(0),
   fVarManager(NULL),
+  fHandleContainer(NULL),
+  fHandleContname(),
+  fRecContainerID(-1),
+  fMCContainerID(-1),
   fCommonObjects(NULL)
 {
   //
@@ -109,6 +117,10 @@ AliHFEpid::AliHFEpid(const AliHFEpid &c):
   fEnabledDetectors(c.fEnabledDetectors),
   fNPIDdetectors(c.fNPIDdetectors),
   fVarManager(c.fVarManager),
+  fHandleContainer(NULL),
+  fHandleContname(),
+  fRecContainerID(-1),
+  fMCContainerID(-1),
   fCommonObjects(NULL)
 {
   //
@@ -150,6 +162,7 @@ void AliHFEpid::Copy(TObject &o) const{
   target.fEnabledDetectors = fEnabledDetectors;
   target.fNPIDdetectors = fNPIDdetectors;
   target.fVarManager = fVarManager;
+  target.fHandleContainer = NULL;   // container handles are resolved again at the next use
  
   // Copy detector PIDs
   for(Int_t idet = 0; idet < kNdetectorPID; idet++){
@@ -259,23 +272,19 @@ Bool_t AliHFEpid::IsSelected(const AliHFEpidObject * const track, AliHFEcontaine
     }
     AliDebug(2, "Particlae selected by detector");
     if(fVarManager && cont){
-      TString reccontname = contname; reccontname += "Reco";
-      AliDebug(2, Form("Filling container %s", reccontname.Data()));
-      if(fVarManager->IsSignalTrack())
-        fVarManager->FillContainerStepname(cont, reccontname.Data(), SortedDetectorName(idet));
+      if(cont != fHandleContainer || fHandleContname.CompareTo(contname)) ResolveContainerHandles(cont, contname);
+      AliDebug(2, Form("Filling containers %sReco/%sMC, step %s", contname, contname, SortedDetectorName(idet)));
+      if(fVarManager->IsSignalTrack() && fRecStepID[idet] >= 0)
+        fVarManager->FillContainer(cont, fRecContainerID, fRecStepID[idet]);
       if(HasMCData()){
-        TString mccontname = contname; mccontname += "MC";
-        AliDebug(2, Form("MC Information available, Filling container %s", mccontname.Data()));
         if(fVarManager->IsSignalTrack()) {
-          fVarManager->FillContainerStepname(cont, mccontname.Data(), SortedDetectorName(idet), kTRUE);
-	        if(cont->GetCorrelationMatrix("correlationstepafterTOF")){
-	          TString tstept("TOFPID"); 
-	          if(!tstept.CompareTo(SortedDetectorName(idet))) {
-	            fVarManager->FillCorrelationMatrix(cont->GetCorrelationMatrix("correlationstepafterTOF"));
-	            //printf("Step %s\n",(const char*) SortedDetectorName(idet));
-	          }
-	        }
-	      }
+          if(fMCStepID[idet] >= 0)
+            fVarManager->FillContainer(cont, fMCContainerID, fMCStepID[idet], kTRUE);
+          if(fSortedOrder[idet] == kTOFpid){
+            THnSparseF *correlation = cont->GetCorrelationMatrix("correlationstepafterTOF");
+            if(correlation) fVarManager->FillCorrelationMatrix(correlation);
+          }
+        }
       }
       // The PID will NOT fill the double counting information
     }
@@ -283,6 +292,26 @@ Bool_t AliHFEpid::IsSelected(const AliHFEpidObject * const track, AliHFEcontaine
   return isSelected;
 }
 
+//____________________________________________________________
+void AliHFEpid::ResolveContainerHandles(AliHFEcontainer *cont, const Char_t *contname){
+  //
+  // Resolve the handles of the Reco and MC containers and of the
+  // steps of the PID detectors, used by IsSelected to fill the
+  // containers without name lookups
+  //
+  fHandleContainer = cont;
+  fHandleContname = contname;
+  fRecContainerID = cont->GetContainerID(Form("%sReco", contname));
+  fMCContainerID = cont->GetContainerID(Form("%sMC", contname));
+  for(UInt_t idet = 0; idet < kNdetectorPID; idet++){
+    fRecStepID[idet] = fMCStepID[idet] = -1;
+    if(idet >= fNPIDdetectors) continue;
+    fRecStepID[idet] = cont->GetStepID(fRecContainerID, SortedDetectorName(idet));
+    fMCStepID[idet] = cont->GetStepID(fMCContainerID, SortedDetectorName(idet));
+    if(fRecStepID[idet] < 0) AliDebug(1, Form("Step %s not found in container %sReco", SortedDetectorName(idet), contname));
+  }
+}
+
 //____________________________________________________________
 void AliHFEpid::SortDetectors(){
   //
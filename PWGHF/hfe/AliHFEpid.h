@@ -114,6 +114,7 @@ class AliHFEpid : public TNamed{
 
     void AddCommonObject(TObject * const o);
     void ClearCommonObjects();
+    void ResolveContainerHandles(AliHFEcontainer *cont, const Char_t *contname);
     //-----Switch on/off detectors in PID sequence------
     void SwitchOnDetector(UInt_t det){ 
       if(det < kNdetectorPID) SETBIT(fEnabledDetectors, det);
@@ -134,6 +135,12 @@ class AliHFEpid : public TNamed{
     UInt_t fEnabledDetectors;                       //   Enabled Detectors
     UInt_t fNPIDdetectors;                          //   Number of PID detectors
     AliHFEvarManager *fVarManager;                  //!  HFE Var Manager
+    AliHFEcontainer *fHandleContainer;              //!  Container the handles below belong to
+    TString fHandleContname;                        //!  Container name the handles were resolved for
+    Int_t fRecContainerID;                          //!  Handle of the Reco container
+    Int_t fMCContainerID;                           //!  Handle of the MC container
+    Int_t fRecStepID[kNdetectorPID];                //!  Step of each sorted detector in the Reco container
+    Int_t fMCStepID[kNdetectorPID];                 //!  Step of each sorted detector in the MC container
     TObjArray *fCommonObjects;                      //   Garbage Collector
 
   ClassDef(AliHFEpid, 1)      // Steering class for Electron ID
@@ -377,6 +377,18 @@ void AliHFEvarManager::FillContainer(const AliHFEcontainer *const cont, const Ch
 	cont->FillCFContainer(contname, step, content, fWeightFactor * externalWeight);
 }  
 
+//____________________________________________________________
+void AliHFEvarManager::FillContainer(const AliHFEcontainer *const cont, Int_t contID, UInt_t step, Bool_t useMC, Double_t externalWeight) const {
+	//
+	// Fill CF container with defined content, container given by the
+	// handle from AliHFEcontainer::GetContainerID
+	//
+
+  Double_t *content = fContent;
+  if(useMC) content = fContentMC;
+	cont->FillCFContainer(contID, step, content, fWeightFactor * externalWeight);
+}  
+
 //____________________________________________________________
 void AliHFEvarManager::FillContainerStepname(const AliHFEcontainer *const cont, const Char_t *contname, const Char_t *step, Bool_t useMC, Double_t externalWeight) const {
 	//
@@ -73,6 +73,7 @@ public:
   Bool_t IsSignalTrack() const { return fSignalTrack; }
   void FillContainer(AliCFContainer *const cont, Int_t step, Bool_t useMC = kFALSE) const;
   void FillContainer(const AliHFEcontainer *const cont, const Char_t *contname, UInt_t step, Bool_t useMC = kFALSE, Double_t externalWeight = 1.) const;
+  void FillContainer(const AliHFEcontainer *const cont, Int_t contID, UInt_t step, Bool_t useMC = kFALSE, Double_t externalWeight = 1.) const;
   void FillContainerStepname(const AliHFEcontainer *const cont, const Char_t *contname, const Char_t *step, Bool_t useMC = kFALSE, Double_t externalWeight = 1.) const;
   void FillCorrelationMatrix(THnSparseF *matrix) const;
   
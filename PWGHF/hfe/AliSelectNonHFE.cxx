@@ -87,6 +87,9 @@ AliSelectNonHFE::AliSelectNonHFE(const char *name, const Char_t *title)
 ,fEtaCutMax(0.8)
 ,fRequireTPCNclusForPID(kFALSE)
 ,fTpcNclsPID(60)
+,fUsePartnerPreselection(kFALSE)
+,fPartnerIndex()
+,fPartnerParam()
 {
     //
     // Constructor
@@ -146,6 +149,9 @@ AliSelectNonHFE::AliSelectNonHFE()
 ,fEtaCutMax(0.8)
 ,fRequireTPCNclusForPID(kFALSE)
 ,fTpcNclsPID(60)
+,fUsePartnerPreselection(kFALSE)
+,fPartnerIndex()
+,fPartnerParam()
 
 {
     //
@@ -179,6 +185,113 @@ AliSelectNonHFE::~AliSelectNonHFE()
     
 }
 
+//__________________________________________
+Bool_t AliSelectNonHFE::IsPartner(AliVParticle *Vtrack2, AliVEvent *fVevent, Bool_t keepTrack)
+{
+    //
+    // Quality cuts and PID of the partner track. The DCA cut propagates
+    // the AOD track to the vertex, or a copy of it if keepTrack is set
+    //
+    
+    AliVTrack *track2 = dynamic_cast<AliVTrack*>(Vtrack2);
+    AliAODTrack *atrack2 = dynamic_cast<AliAODTrack*>(Vtrack2);
+    AliESDtrack *etrack2 = dynamic_cast<AliESDtrack*>(Vtrack2);
+    
+    //Partner track cuts
+    if(fIsAOD)
+    {
+        //AOD Filter Bit
+        if (fUseGlobalTracks)
+        {
+            if(!atrack2->TestFilterMask(AliAODTrack::kTrkGlobalNoDCA)) return kFALSE; //Same as trigger
+        }
+        else
+        {
+         if(!atrack2->TestFilterMask(AliAODTrack::kTrkTPCOnly)) return kFALSE; //Old one
+        }
+        
+        //ITS and TPC refit
+        if((!(atrack2->GetStatus()&AliESDtrack::kITSrefit)|| (!(atrack2->GetStatus()&AliESDtrack::kTPCrefit)))) return kFALSE;
+        
+        //Eta cut
+        if (fUseEtaCutForPart)
+            if(atrack2->Eta() < fEtaCutMin || atrack2->Eta() > fEtaCutMax)
+                return kFALSE;
+        
+        //NClusters on TPC
+        if(atrack2->GetTPCNcls() < fTpcNcls) return kFALSE;
+        
+        //TPC NClusters for PID
+        if (fRequireTPCNclusForPID)
+            if(atrack2->GetTPCsignalN() < fTpcNclsPID) return kFALSE;
+        
+        
+        //Number of Clusters on ITS
+        if (fRequirePointOnITS)
+            if (atrack2->GetITSNcls() < fNClusITS) return kFALSE;   //Add minimum number of clusters on the ITS
+        
+        if (fUseDCAPartnerCut)
+        {
+        //Calculate DCA
+            Double_t d0z0[2], cov[3];
+            const AliVVertex *pVtx = fVevent->GetPrimaryVertex();
+            Bool_t hasDCA = kFALSE;
+            if(keepTrack)
+            {
+                AliAODTrack dcaTrack(*atrack2);
+                hasDCA = dcaTrack.PropagateToDCA(pVtx, fVevent->GetMagneticField(), 20., d0z0, cov);
+            }
+            else hasDCA = atrack2->PropagateToDCA(pVtx, fVevent->GetMagneticField(), 20., d0z0, cov);
+            if(hasDCA){
+                if(TMath::Abs(d0z0[0]) > fDCAcutxyPartner || TMath::Abs(d0z0[1]) > fDCAcutzPartner ) return kFALSE;
+            }
+        }
+        
+    }
+    else
+    {
+        if(!fTrackCuts->AcceptTrack(etrack2)) return kFALSE;
+    }
+    
+    //Partner track pid
+    Double_t tpcNsigma2 = fPIDResponse->NumberOfSigmasTPC(track2,AliPID::kElectron);
+    if(tpcNsigma2<fTPCnSigmaMin || tpcNsigma2>fTPCnSigmaMax) return kFALSE;
+    
+    //Pt Cut
+    if((track2->Pt() < fPtMin) && (fHasPtCut)) return kFALSE;
+    
+    return kTRUE;
+}
+
+//__________________________________________
+void AliSelectNonHFE::PreselectPartners(AliVEvent *fVevent)
+{
+    //
+    // Apply the partner cuts and PID once for the event: FindNonHFE then pairs
+    // the electron candidates only with the selected partners. With
+    // SetPartnerPreselection on, the user task must call it once per event,
+    // after setting the partner cuts and before the first FindNonHFE.
+    // The DCA cut is computed on a copy of the track, the event is unchanged.
+    //
+    
+    fPartnerIndex.clear();
+    fPartnerParam.clear();
+    
+    for(Int_t iTrack2 = 0; iTrack2 < fVevent->GetNumberOfTracks(); iTrack2++)
+    {
+        AliVParticle* Vtrack2 = fVevent->GetTrack(iTrack2);
+        if (!Vtrack2) continue;
+        
+        if(!IsPartner(Vtrack2, fVevent, kTRUE)) continue;
+        
+        AliExternalTrackParam extTrackParam2;
+        extTrackParam2.CopyFromVTrack(dynamic_cast<AliVTrack*>(Vtrack2));
+        
+        fPartnerIndex.push_back(iTrack2);
+        fPartnerParam.push_back(extTrackParam2);
+    }
+}
+
 //__________________________________________
 void AliSelectNonHFE::FindNonHFE(Int_t iTrack1, AliVParticle *Vtrack1, AliVEvent *fVevent)
 {
@@ -207,8 +320,14 @@ void AliSelectNonHFE::FindNonHFE(Int_t iTrack1, AliVParticle *Vtrack1, AliVEvent
     fLSPartner = new int [100]; 	//store the partners index
     fULSPartner = new int [100];	//store the partners index
     
-    for(Int_t iTrack2 = 0; iTrack2 < fVevent->GetNumberOfTracks(); iTrack2++)
+    //Partners preselected once for the event (PreselectPartners), or all tracks of the event
+    Bool_t usePreselection = fUsePartnerPreselection;
+    Int_t nPartners = usePreselection ? (Int_t)fPartnerIndex.size() : fVevent->GetNumberOfTracks();
+    
+    for(Int_t iPartner = 0; iPartner < nPartners; iPartner++)
     {
+        Int_t iTrack2 = usePreselection ? fPartnerIndex[iPartner] : iPartner;
+        
         //if(iTrack1==iTrack2) continue;
         
         AliVParticle* Vtrack2 = fVevent->GetTrack(iTrack2);
@@ -219,68 +338,19 @@ void AliSelectNonHFE::FindNonHFE(Int_t iTrack1, AliVParticle *Vtrack1, AliVEvent
         }
         
         AliVTrack *track2 = dynamic_cast<AliVTrack*>(Vtrack2);
-        AliAODTrack *atrack2 = dynamic_cast<AliAODTrack*>(Vtrack2);
         AliESDtrack *etrack2 = dynamic_cast<AliESDtrack*>(Vtrack2);
         AliExternalTrackParam extTrackParam2;
-        extTrackParam2.CopyFromVTrack(track2);
-
         
-        //Second track cuts
-        if(fIsAOD)
+        if(usePreselection)
         {
-            //AOD Filter Bit
-            if (fUseGlobalTracks)
-            {
-                if(!atrack2->TestFilterMask(AliAODTrack::kTrkGlobalNoDCA)) continue; //Same as trigger
-            }
-            else
-            {
-             if(!atrack2->TestFilterMask(AliAODTrack::kTrkTPCOnly)) continue; //Old one
-            }
-            
-            //ITS and TPC refit
-            if((!(atrack2->GetStatus()&AliESDtrack::kITSrefit)|| (!(atrack2->GetStatus()&AliESDtrack::kTPCrefit)))) continue;
-            
-            //Eta cut
-            if (fUseEtaCutForPart)
-                if(atrack2->Eta() < fEtaCutMin || atrack2->Eta() > fEtaCutMax)
-                    continue;
-            
-            //NClusters on TPC
-            if(atrack2->GetTPCNcls() < fTpcNcls) continue;
-            
-            //TPC NClusters for PID
-            if (fRequireTPCNclusForPID)
-                if(atrack2->GetTPCsignalN() < fTpcNclsPID) continue;
-            
-            
-            //Number of Clusters on ITS
-            if (fRequirePointOnITS)
-                if (atrack2->GetITSNcls() < fNClusITS) continue;   //Add minimum number of clusters on the ITS
-            
-            if (fUseDCAPartnerCut)
-            {
-            //Calculate DCA
-                Double_t d0z0[2], cov[3];
-                const AliVVertex *pVtx = fVevent->GetPrimaryVertex();
-                if(atrack2->PropagateToDCA(pVtx, fVevent->GetMagneticField(), 20., d0z0, cov)){
-                    if(TMath::Abs(d0z0[0]) > fDCAcutxyPartner || TMath::Abs(d0z0[1]) > fDCAcutzPartner ) continue;
-                }
-            }
-            
+            extTrackParam2 = fPartnerParam[iPartner];
         }
         else
         {
-            if(!fTrackCuts->AcceptTrack(etrack2)) continue;
+            extTrackParam2.CopyFromVTrack(track2);
+            if(!IsPartner(Vtrack2, fVevent)) continue;
         }
         
-        //Second track pid
-        Double_t tpcNsigma2 = fPIDResponse->NumberOfSigmasTPC(track2,AliPID::kElectron);
-        if(tpcNsigma2<fTPCnSigmaMin || tpcNsigma2>fTPCnSigmaMax) continue;
-        
-        //Pt Cut
-        if((track2->Pt() < fPtMin) && (fHasPtCut)) continue;
-        
         if(fAlgorithm=="DCA")
         {
             //Variables
@@ -18,6 +18,9 @@
 #include <TNamed.h>
 #endif
 
+#include <vector>
+#include "AliExternalTrackParam.h"
+
 class TH1F;
 class TH2F;
 class AliVEvent;
@@ -37,6 +40,8 @@ class AliSelectNonHFE : public TNamed {
   Bool_t IsLS() const {return fIsLS;};
   Bool_t IsULS() const {return fIsULS;};
   void FindNonHFE(Int_t iTrack1, AliVParticle *Vtrack1, AliVEvent *fVevent);
+  void PreselectPartners(AliVEvent *fVevent);
+  void SetPartnerPreselection(Bool_t UsePreselection) {fUsePartnerPreselection = UsePreselection;}; //PreselectPartners must then be called at each event
   void SetAlgorithm(TString Algorithm) {fAlgorithm = Algorithm;};
 	
   void SetAdditionalCuts(Double_t PtMin, Int_t TpcNcls) {fPtMin = PtMin; fTpcNcls = TpcNcls; fHasPtCut=kTRUE; };
@@ -112,6 +117,8 @@ class AliSelectNonHFE : public TNamed {
   Double_t fEtaCutMin; // min eta cut
   Double_t fEtaCutMax; // max eta cut
 
+  Bool_t fUsePartnerPreselection; // Apply the partner cuts once per event
+
 	
   Int_t			*fLSPartner;	        //! Pointer for the LS partners index
   Int_t			*fULSPartner;	        //! Pointer for the ULS partners index
@@ -123,10 +130,15 @@ class AliSelectNonHFE : public TNamed {
   TH1F			*fHistAngleBack;        //! Opening Angle histogram for like sign pairs
   AliPIDResponse *fPIDResponse;     	//! PID response object
   
+  std::vector<Int_t> fPartnerIndex;		//! Index of the preselected partners
+  std::vector<AliExternalTrackParam> fPartnerParam; //! Track parameters of the preselected partners
+  
+  Bool_t IsPartner(AliVParticle *Vtrack2, AliVEvent *fVevent, Bool_t keepTrack=kFALSE);
+  
   AliSelectNonHFE(const AliSelectNonHFE&); // not implemented
   AliSelectNonHFE& operator=(const AliSelectNonHFE&); // not implemented
   
-  ClassDef(AliSelectNonHFE, 1); //!example of analysis
+  ClassDef(AliSelectNonHFE, 2); //!example of analysis
 };
 
 #endif
@@ -19,9 +19,13 @@
 
 #include "AliJetResponseMaker.h"
 
+#include <algorithm>
+
 #include <TClonesArray.h>
+#include <TExMap.h>
 #include <TH2F.h>
 #include <THnSparse.h>
+#include <TVector2.h>
 
 #include "AliTLorentzVector.h"
 #include "AliAnalysisManager.h"
@@ -44,6 +48,7 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fMatchingPar1(0),
   fMatchingPar2(0),
   fUseCellsToMatch(kFALSE),
+  fUseMatchingIndex(kFALSE),
   fMinJetMCPt(1),
   fHistoType(0),
   fDeltaPtAxis(0),
@@ -59,6 +64,15 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fJetRelativeEPAngle(0),
   fIsJet1Rho(kFALSE),
   fIsJet2Rho(kFALSE),
+  fIndexedJets2(),
+  fGridCellStart(),
+  fGridJets(),
+  fGridNEta(0),
+  fGridNPhi(0),
+  fGridEtaMin(0),
+  fGridCellSize(0),
+  fTrackIndexToJet2(0),
+  fClusterIndexToJet2(0),
   fHistRejectionReason1(0),
   fHistRejectionReason2(0),
   fHistJets1(0),
@@ -132,6 +146,7 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fMatchingPar1(0),
   fMatchingPar2(0),
   fUseCellsToMatch(kFALSE),
+  fUseMatchingIndex(kFALSE),
   fMinJetMCPt(1),
   fHistoType(0),
   fDeltaPtAxis(0),
@@ -147,6 +162,15 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fJetRelativeEPAngle(0),
   fIsJet1Rho(kFALSE),
   fIsJet2Rho(kFALSE),
+  fIndexedJets2(),
+  fGridCellStart(),
+  fGridJets(),
+  fGridNEta(0),
+  fGridNPhi(0),
+  fGridEtaMin(0),
+  fGridCellSize(0),
+  fTrackIndexToJet2(0),
+  fClusterIndexToJet2(0),
   fHistRejectionReason1(0),
   fHistRejectionReason2(0),
   fHistJets1(0),
@@ -217,6 +241,9 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
 AliJetResponseMaker::~AliJetResponseMaker()
 {
   // Destructor
+
+  delete fTrackIndexToJet2;
+  delete fClusterIndexToJet2;
 }
 
 
@@ -1404,6 +1431,11 @@ void AliJetResponseMaker::DoJetLoop()
 
   if (!jets1 || !jets1->GetArray() || !jets2 || !jets2->GetArray()) return;
 
+  if (fUseMatchingIndex) {
+    DoIndexedJetLoop(jets1, jets2);
+    return;
+  }
+
   AliEmcalJet* jet1 = 0;
   AliEmcalJet* jet2 = 0;
 
@@ -1423,6 +1455,340 @@ void AliJetResponseMaker::DoJetLoop()
   } // jet1 loop
 }
 
+//________________________________________________________________________
+void AliJetResponseMaker::DoIndexedJetLoop(AliJetContainer *jets1, AliJetContainer *jets2)
+{
+  // Do the jet loop considering only the candidate pairs that can be matched:
+  // for the geometrical matching the jets 2 in the neighbouring eta-phi cells,
+  // otherwise the jets 2 that share at least one constituent (or MC label) with jet 1.
+  // The matching level of the candidate pairs is identical to the one of the full loop;
+  // jets without any candidate are left without closest jet.
+
+  AliEmcalJet* jet1 = 0;
+  AliEmcalJet* jet2 = 0;
+
+  fIndexedJets2.clear();
+  jets2->ResetCurrentID();
+  while ((jet2 = jets2->GetNextJet())) {
+    jet2->ResetMatching();
+    fIndexedJets2.push_back(jet2);
+  }
+
+  // Pairwise evaluation is kept for the cell based matching, the constituent index is only used to find the candidates
+  Bool_t pairwise = (fMatching == kGeometrical) || (fUseCellsToMatch && fCaloCells);
+
+  if (fMatching == kGeometrical) BuildJetGrid();
+  else BuildConstituentIndex();
+
+  std::vector<Int_t> candidates;
+  std::vector<Double_t> shared1;
+  std::vector<Double_t> shared2;
+
+  jets1->ResetCurrentID();
+  while ((jet1 = jets1->GetNextJet())) {
+    jet1->ResetMatching();
+
+    if (jet1->MCPt() < fMinJetMCPt) continue;
+
+    Double_t nonMCPt1 = 0;
+    if (fMatching == kGeometrical) {
+      FindGeometricalCandidates(jet1, candidates);
+    }
+    else {
+      FindConstituentCandidates(jet1, candidates, shared1, shared2, nonMCPt1);
+    }
+
+    for (UInt_t i = 0; i < candidates.size(); i++) {
+      jet2 = fIndexedJets2[candidates[i]];
+
+      if (pairwise) {
+        SetMatchingLevel(jet1, jet2, fMatching);
+        continue;
+      }
+
+      Double_t d1 = jet1->Pt() - nonMCPt1 - shared1[i];
+      Double_t d2 = jet2->Pt() - shared2[i];
+      if (d1 < 0) d1 = 0;
+      if (d2 < 0) d2 = 0;
+
+      Double_t totalPt1 = jet1->Pt() - nonMCPt1;
+      if (fMatching == kMCLabel) {
+        if (totalPt1 < 1) d1 = -1;
+        else d1 /= totalPt1;
+
+        if (jet2->Pt() < 1) d2 = -1;
+        else d2 /= jet2->Pt();
+      }
+      else {
+        if (jet1->Pt() > 0) d1 /= jet1->Pt();
+        else d1 = -1;
+
+        if (jet2->Pt() > 0) d2 /= jet2->Pt();
+        else d2 = -1;
+      }
+
+      UpdateClosestJets(jet1, jet2, d1, d2);
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::BuildJetGrid()
+{
+  // Sort the jets 2 in an eta-phi grid whose cells are at least as large as the maximum matching distance,
+  // so that all the jets within the matching distance are found in the 3x3 neighbouring cells.
+
+  fGridCellSize = TMath::Max(TMath::Max(fMatchingPar1, fMatchingPar2), 0.05);
+
+  const Int_t njets = fIndexedJets2.size();
+
+  Double_t etaMin = 0, etaMax = 0;
+  for (Int_t i = 0; i < njets; i++) {
+    Double_t eta = fIndexedJets2[i]->Eta();
+    if (i == 0 || eta < etaMin) etaMin = eta;
+    if (i == 0 || eta > etaMax) etaMax = eta;
+  }
+
+  fGridEtaMin = etaMin;
+  fGridNEta = TMath::Max(1, TMath::FloorNint((etaMax - etaMin) / fGridCellSize) + 1);
+  fGridNPhi = TMath::Max(1, TMath::FloorNint(TMath::TwoPi() / fGridCellSize));
+
+  const Int_t ncells = fGridNEta * fGridNPhi;
+  std::vector<Int_t> cellOfJet(njets);
+
+  fGridCellStart.assign(ncells + 1, 0);
+  for (Int_t i = 0; i < njets; i++) {
+    Int_t ieta = TMath::FloorNint((fIndexedJets2[i]->Eta() - fGridEtaMin) / fGridCellSize);
+    Int_t iphi = TMath::FloorNint(TVector2::Phi_0_2pi(fIndexedJets2[i]->Phi()) / TMath::TwoPi() * fGridNPhi);
+    if (ieta >= fGridNEta) ieta = fGridNEta - 1;
+    if (iphi >= fGridNPhi) iphi = fGridNPhi - 1;
+    cellOfJet[i] = ieta * fGridNPhi + iphi;
+    fGridCellStart[cellOfJet[i] + 1]++;
+  }
+  for (Int_t icell = 0; icell < ncells; icell++) fGridCellStart[icell + 1] += fGridCellStart[icell];
+
+  // Counting sort, the jets keep the container order within each cell
+  std::vector<Int_t> fill(fGridCellStart.begin(), fGridCellStart.end() - 1);
+  fGridJets.resize(njets);
+  for (Int_t i = 0; i < njets; i++) fGridJets[fill[cellOfJet[i]]++] = i;
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::FindGeometricalCandidates(AliEmcalJet *jet1, std::vector<Int_t> &candidates) const
+{
+  // Collect the jets 2 in the eta-phi cells neighbouring jet 1, in container order.
+
+  candidates.clear();
+
+  if (fGridJets.empty()) return;
+
+  Int_t ieta = TMath::FloorNint((jet1->Eta() - fGridEtaMin) / fGridCellSize);
+  Int_t iphi = TMath::FloorNint(TVector2::Phi_0_2pi(jet1->Phi()) / TMath::TwoPi() * fGridNPhi);
+  if (iphi >= fGridNPhi) iphi = fGridNPhi - 1;
+
+  // With less than 3 phi cells the neighbours wrap onto the same cells
+  Int_t nphi = TMath::Min(fGridNPhi, 3);
+
+  for (Int_t jeta = TMath::Max(ieta - 1, 0); jeta <= TMath::Min(ieta + 1, fGridNEta - 1); jeta++) {
+    for (Int_t k = 0; k < nphi; k++) {
+      Int_t jphi = (iphi - 1 + k + fGridNPhi) % fGridNPhi;
+      Int_t icell = jeta * fGridNPhi + jphi;
+      for (Int_t j = fGridCellStart[icell]; j < fGridCellStart[icell + 1]; j++) candidates.push_back(fGridJets[j]);
+    }
+  }
+
+  // Same order as the full loop, so that jets at equal distance are resolved in the same way
+  std::sort(candidates.begin(), candidates.end());
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::BuildConstituentIndex()
+{
+  // Map the track and cluster constituents of the jets 2 to the jet that contains them.
+  // Values are (jet position + 1) << 32 | constituent position.
+
+  if (!fTrackIndexToJet2) fTrackIndexToJet2 = new TExMap();
+  if (!fClusterIndexToJet2) fClusterIndexToJet2 = new TExMap();
+
+  fTrackIndexToJet2->Delete();
+  fClusterIndexToJet2->Delete();
+
+  for (UInt_t i = 0; i < fIndexedJets2.size(); i++) {
+    AliEmcalJet *jet2 = fIndexedJets2[i];
+    Long64_t jetKey = (Long64_t(i) + 1) << 32;
+    for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
+      (*fTrackIndexToJet2)(jet2->TrackAt(iTrack2)) = jetKey | iTrack2;
+    }
+    for (Int_t iClus2 = 0; iClus2 < jet2->GetNumberOfClusters(); iClus2++) {
+      (*fClusterIndexToJet2)(jet2->ClusterAt(iClus2)) = jetKey | iClus2;
+    }
+  }
+}
+
+//________________________________________________________________________
+Int_t AliJetResponseMaker::AddCandidate(Int_t ijet2, std::vector<Int_t> &candidates, std::vector<Double_t> &shared1, std::vector<Double_t> &shared2) const
+{
+  // Return the position of jet 2 in the candidate list, adding it if needed.
+  // The list is kept in container order, so that jets at equal distance are resolved as in the full loop.
+
+  std::vector<Int_t>::iterator it = std::lower_bound(candidates.begin(), candidates.end(), ijet2);
+  Int_t icand = it - candidates.begin();
+  if (it != candidates.end() && *it == ijet2) return icand;
+
+  candidates.insert(it, ijet2);
+  shared1.insert(shared1.begin() + icand, 0.);
+  shared2.insert(shared2.begin() + icand, 0.);
+
+  return icand;
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::FindConstituentCandidates(AliEmcalJet *jet1, std::vector<Int_t> &candidates,
+    std::vector<Double_t> &shared1, std::vector<Double_t> &shared2, Double_t &nonMCPt1)
+{
+  // Single loop over the constituents of jet 1: find the jets 2 that share at least one constituent
+  // and accumulate the common pt of both jets (same definitions as in GetMCLabelMatchingLevel and
+  // GetSameCollectionsMatchingLevel). For the MC label matching nonMCPt1 is the pt of jet 1 carried
+  // by particles without MC label, which is removed from the total pt.
+
+  AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
+  AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+
+  AliParticleContainer *tracks1   = jets1->GetParticleContainer();
+  AliClusterContainer  *clusters1 = jets1->GetClusterContainer();
+  AliParticleContainer *tracks2   = jets2->GetParticleContainer();
+  AliClusterContainer  *clusters2 = jets2->GetClusterContainer();
+
+  candidates.clear();
+  shared1.clear();
+  shared2.clear();
+  nonMCPt1 = 0;
+
+  const Bool_t mcLabel = (fMatching == kMCLabel);
+  const Bool_t useCells = fUseCellsToMatch && fCaloCells;
+
+  // constituents of the jets 2 that have already been found (for the MC label matching)
+  TExMap found2;
+
+  if (!mcLabel && !(tracks1 && tracks2)) {
+    // no common tracks to look for
+  }
+  else {
+    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+      Int_t index = jet1->TrackAt(iTrack);
+      AliVParticle *track = jet1->Track(iTrack);
+      if (!track) {
+        AliWarning(Form("Could not find track %d!", iTrack));
+        continue;
+      }
+
+      if (mcLabel) {
+        Int_t MClabel = TMath::Abs(track->GetLabel());
+        MClabel -= fMCLabelShift;
+        if (MClabel == 0 && tracks1 && tracks1->GetArray()) nonMCPt1 += track->Pt();
+        if (MClabel <= 0) continue;
+        index = tracks2 ? tracks2->GetIndexFromLabel(MClabel) : -1;
+        if (index < 0) continue;
+      }
+
+      Long64_t value = fTrackIndexToJet2->GetValue(index);
+      if (!value) continue;
+
+      Int_t ijet2 = (value >> 32) - 1;
+      Int_t iTrack2 = value & 0xffffffff;
+      Int_t icand = AddCandidate(ijet2, candidates, shared1, shared2);
+
+      shared1[icand] += track->Pt();
+
+      if (mcLabel && found2.GetValue(index)) continue;
+
+      AliVParticle *part2 = fIndexedJets2[ijet2]->Track(iTrack2);
+      if (!part2) {
+        AliWarning(Form("Could not find track %d!", index));
+        continue;
+      }
+      shared2[icand] += part2->Pt();
+      found2.Add(index, 1);
+    }
+  }
+
+  if (useCells) {
+    // the common energy is computed pairwise for the candidates, here only look for them
+    if (mcLabel) {
+      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+        AliVCluster *clus = jet1->Cluster(iClus);
+        if (!clus) continue;
+        for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
+          Int_t MClabel = TMath::Abs(fCaloCells->GetCellMCLabel(clus->GetCellAbsId(iCell)));
+          MClabel -= fMCLabelShift;
+          if (MClabel <= 0) continue;
+          Int_t index = tracks2 ? tracks2->GetIndexFromLabel(MClabel) : -1;
+          if (index < 0) continue;
+          Long64_t value = fTrackIndexToJet2->GetValue(index);
+          if (value) AddCandidate((value >> 32) - 1, candidates, shared1, shared2);
+        }
+      }
+    }
+    else if (clusters1 && clusters2) {
+      // jets sharing cells but no cluster are not considered
+      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+        Long64_t value = fClusterIndexToJet2->GetValue(jet1->ClusterAt(iClus));
+        if (value) AddCandidate((value >> 32) - 1, candidates, shared1, shared2);
+      }
+    }
+  }
+  else if (mcLabel || (clusters1 && clusters2)) {
+    for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+      Int_t index = jet1->ClusterAt(iClus);
+      AliVCluster *clus = jet1->Cluster(iClus);
+      if (!clus) {
+        AliWarning(Form("Could not find cluster %d!", iClus));
+        continue;
+      }
+      AliTLorentzVector part;
+      clus->GetMomentum(part, fVertex);
+
+      TExMap *indexToJet2 = fClusterIndexToJet2;
+      if (mcLabel) {
+        Int_t MClabel = TMath::Abs(clus->GetLabel());
+        MClabel -= fMCLabelShift;
+        if (MClabel == 0) nonMCPt1 += part.Pt();
+        if (MClabel <= 0) continue;
+        index = tracks2 ? tracks2->GetIndexFromLabel(MClabel) : -1;
+        if (index < 0) continue;
+        indexToJet2 = fTrackIndexToJet2;
+      }
+
+      Long64_t value = indexToJet2->GetValue(index);
+      if (!value) continue;
+
+      Int_t ijet2 = (value >> 32) - 1;
+      Int_t iConst2 = value & 0xffffffff;
+      Int_t icand = AddCandidate(ijet2, candidates, shared1, shared2);
+
+      shared1[icand] += part.Pt();
+
+      if (mcLabel) {
+        if (found2.GetValue(index)) continue;
+        AliVParticle *MCpart = fIndexedJets2[ijet2]->Track(iConst2);
+        if (!MCpart) continue;
+        shared2[icand] += MCpart->Pt();
+        found2.Add(index, 1);
+      }
+      else {
+        AliVCluster *clus2 = fIndexedJets2[ijet2]->Cluster(iConst2);
+        if (!clus2) {
+          AliWarning(Form("Could not find cluster %d!", index));
+          continue;
+        }
+        AliTLorentzVector part2;
+        clus2->GetMomentum(part2, fVertex);
+        shared2[icand] += part2.Pt();
+      }
+    }
+  }
+}
+
 //________________________________________________________________________
 void AliJetResponseMaker::GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const
 {
@@ -1543,7 +1909,7 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
       d1 -= track->Pt();
 
       if (!track2Found) {
-        AliVParticle *MCpart = jet2->Track(index2);
+        AliVParticle *MCpart = jet2->Track(iTrack2);
         AliDebug(3,Form("Track %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
             iTrack,track->Pt(),track->Eta(),track->Phi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
         d2 -= MCpart->Pt();
@@ -1584,7 +1950,7 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
           d1 -= part.Pt() * cellFrac;
 
           if (!track2Found) { // only if it is not already found among charged tracks (charged particles are most likely already found)
-            AliVParticle *MCpart = jet2->Track(index2);
+            AliVParticle *MCpart = jet2->Track(iTrack2);
             AliDebug(3,Form("Cell %d belonging to cluster %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
                 iCell,iClus,part.Pt(),part.Eta(),part.Phi_0_2pi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
             d2 -= MCpart->Pt() * cellFrac;
@@ -1622,7 +1988,7 @@ void AliJetResponseMaker::GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet
         d1 -= part.Pt();
 
         if (!track2Found) { // only if it is not already found among charged tracks (charged particles are most likely already found)
-          AliVParticle *MCpart = jet2->Track(index2);
+          AliVParticle *MCpart = jet2->Track(iTrack2);
           AliDebug(3,Form("Cluster %d (pT = %f, eta = %f, phi = %f) is associated with the MC particle %d (pT = %f, eta = %f, phi = %f)!",
               iClus,part.Pt(),part.Eta(),part.Phi_0_2pi(),MClabel,MCpart->Pt(),MCpart->Eta(),MCpart->Phi()));
 
@@ -1867,6 +2233,12 @@ void AliJetResponseMaker::SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2,
     ;
   }
 
+  UpdateClosestJets(jet1, jet2, d1, d2);
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::UpdateClosestJets(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t d1, Double_t d2)
+{
   if (d1 >= 0) {
 
     if (d1 < jet1->ClosestJetDistance()) {
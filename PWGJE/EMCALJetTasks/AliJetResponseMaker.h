@@ -20,10 +20,13 @@
 //-----------------------------------------------------------------------
 
 class TClonesArray;
+class TExMap;
 class TH2;
 class THnSparse;
 class AliNamedArrayI;
 
+#include <vector>
+
 #include "AliEmcalJet.h"
 #include "AliAnalysisTaskEmcalJet.h"
 
@@ -45,6 +48,7 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   void                        SetMatching(MatchingType t, Double_t p1=1, Double_t p2=1)       { fMatching = t; fMatchingPar1 = p1; fMatchingPar2 = p2; }
   void                        SetPtHardBin(Int_t b)                                           { fSelectPtHardBin   = b         ; }
   void                        SetUseCellsToMatch(Bool_t i)                                    { fUseCellsToMatch   = i         ; }
+  void                        SetUseMatchingIndex(Bool_t i)                                   { fUseMatchingIndex  = i         ; }
   void                        SetMinJetMCPt(Float_t pt)                                       { fMinJetMCPt        = pt        ; }
   void                        SetHistoType(Int_t b)                                           { fHistoType         = b         ; }
   void                        SetDeltaPtAxis(Int_t b)                                         { fDeltaPtAxis       = b         ; }
@@ -62,6 +66,13 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
  protected:
   void                        ExecOnce();
   void                        DoJetLoop();
+  void                        DoIndexedJetLoop(AliJetContainer *jets1, AliJetContainer *jets2);
+  void                        BuildJetGrid();
+  void                        BuildConstituentIndex();
+  void                        FindGeometricalCandidates(AliEmcalJet *jet1, std::vector<Int_t> &candidates) const;
+  void                        FindConstituentCandidates(AliEmcalJet *jet1, std::vector<Int_t> &candidates, std::vector<Double_t> &shared1, std::vector<Double_t> &shared2, Double_t &nonMCPt1);
+  Int_t                       AddCandidate(Int_t ijet2, std::vector<Int_t> &candidates, std::vector<Double_t> &shared1, std::vector<Double_t> &shared2) const;
+  void                        UpdateClosestJets(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t d1, Double_t d2);
   Bool_t                      FillHistograms();
   Bool_t                      Run();
   Bool_t                      DoJetMatching();
@@ -79,6 +90,7 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Double_t                    fMatchingPar1;                           // matching parameter for jet1-jet2 matching
   Double_t                    fMatchingPar2;                           // matching parameter for jet2-jet1 matching
   Bool_t                      fUseCellsToMatch;                        // use cells instead of clusters to match jets (slower but sometimes needed)
+  Bool_t                      fUseMatchingIndex;                       // restrict the jet pairs to eta-phi neighbours or jets sharing constituents (see DoIndexedJetLoop)
   Double_t                    fMinJetMCPt;                             // minimum jet MC pt
   Int_t                       fHistoType;                              // histogram type (0=TH2, 1=THnSparse)
   Int_t                       fDeltaPtAxis;                            // add delta pt axis in THnSparse (default=0)
@@ -96,6 +108,17 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Bool_t                      fIsJet1Rho;                              //!whether the jet1 collection has to be average subtracted
   Bool_t                      fIsJet2Rho;                              //!whether the jet2 collection has to be average subtracted
 
+  // Matching index (rebuilt every event)
+  std::vector<AliEmcalJet*>   fIndexedJets2;                           //!jet2 collection in container order
+  std::vector<Int_t>          fGridCellStart;                          //!first entry of each eta-phi cell in fGridJets
+  std::vector<Int_t>          fGridJets;                               //!jet2 positions sorted by eta-phi cell
+  Int_t                       fGridNEta;                               //!number of eta cells
+  Int_t                       fGridNPhi;                               //!number of phi cells
+  Double_t                    fGridEtaMin;                             //!lower eta edge of the grid
+  Double_t                    fGridCellSize;                           //!eta width of a grid cell (phi width is >= this)
+  TExMap                     *fTrackIndexToJet2;                       //!track global index -> (jet2 position + 1, constituent position)
+  TExMap                     *fClusterIndexToJet2;                     //!cluster global index -> (jet2 position + 1, constituent position)
+
   TH2                        *fHistRejectionReason1;                   //!Rejection reason vs. jet pt
   TH2                        *fHistRejectionReason2;                   //!Rejection reason vs. jet pt
 
@@ -172,6 +195,6 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   AliJetResponseMaker(const AliJetResponseMaker&);            // not implemented
   AliJetResponseMaker &operator=(const AliJetResponseMaker&); // not implemented
 
-  ClassDef(AliJetResponseMaker, 29) // Jet response matrix producing task
+  ClassDef(AliJetResponseMaker, 30) // Jet response matrix producing task
 };
 #endif
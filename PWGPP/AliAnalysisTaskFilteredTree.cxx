@@ -123,6 +123,12 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fLaserTree(0)
   , fMCEffTree(0)
   , fCosmicPairsTree(0)
+  , fHighPtStream(0)
+  , fV0Stream(0)
+  , fdEdxStream(0)
+  , fLaserStream(0)
+  , fMCEffStream(0)
+  , fCosmicPairsStream(0)
   , fPtResPhiPtTPC(0)
   , fPtResPhiPtTPCc(0)
   , fPtResPhiPtTPCITS(0)
@@ -133,10 +139,17 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fPtResCentPtTPCc(0)
   , fPtResCentPtTPCITS(0)
   , fCurrentFileName("")
+  , fTriggerClass("")
   , fDummyTrack(0)
 {
   // Constructor
 
+  for (Int_t i=0; i<2; i++) {
+    fHighPtFriendBranches[i]=0;
+    fV0FriendBranches[i]=0;
+    fCosmicPairsFriendBranches[i]=0;
+  }
+
   // Define input and output slots here
   DefineOutput(1, TTree::Class());
   DefineOutput(2, TTree::Class());
@@ -200,12 +213,19 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
 
   //
   // Create trees
-  fV0Tree = ((*fTreeSRedirector)<<"V0s").GetTree();
-  fHighPtTree = ((*fTreeSRedirector)<<"highPt").GetTree();
-  fdEdxTree = ((*fTreeSRedirector)<<"dEdx").GetTree();
-  fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
-  fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
-  fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  // the streams are resolved once, the event loop writes to them directly
+  fV0Stream = &((*fTreeSRedirector)<<"V0s");
+  fHighPtStream = &((*fTreeSRedirector)<<"highPt");
+  fdEdxStream = &((*fTreeSRedirector)<<"dEdx");
+  fLaserStream = &((*fTreeSRedirector)<<"Laser");
+  fMCEffStream = &((*fTreeSRedirector)<<"MCEffTree");
+  fCosmicPairsStream = &((*fTreeSRedirector)<<"CosmicPairs");
+  fV0Tree = fV0Stream->GetTree();
+  fHighPtTree = fHighPtStream->GetTree();
+  fdEdxTree = fdEdxStream->GetTree();
+  fLaserTree = fLaserStream->GetTree();
+  fMCEffTree = fMCEffStream->GetTree();
+  fCosmicPairsTree = fCosmicPairsStream->GetTree();
 
   if (!fDummyTrack)  {
     fDummyTrack=new AliESDtrack();
@@ -314,6 +334,8 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
     Printf("ERROR: ESD event not available");
     return;
   }
+  // event constants shared by all the trees
+  fTriggerClass.SetString(fESD->GetFiredTriggerClasses());
   //if MC info available - use it.
   fMC = MCEvent();
   if (fMC){  
@@ -463,7 +485,6 @@ void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliES
       Int_t timeStamp    = event->GetTimeStamp();
       ULong64_t triggerMask = event->GetTriggerMask();
       Float_t magField    = event->GetMagneticField();
-      TObjString triggerClass = event->GetFiredTriggerClasses().Data();
 
       // Global event id calculation using orbitID, bunchCrossingID and periodID
       ULong64_t orbitID      = (ULong64_t)event->GetOrbitNumber();
@@ -489,31 +510,21 @@ void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliES
 	}
       }
       if (fFriendDownscaling<=0){
-	if (((*fTreeSRedirector)<<"CosmicPairs").GetTree()){
-	  TTree * tree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
-	  if (tree){
-	    Double_t sizeAll=tree->GetZipBytes();
-	    TBranch * br= tree->GetBranch("friendTrack0.fPoints");
-	    Double_t sizeFriend=(br!=NULL)?br->GetZipBytes():0;
-	    br= tree->GetBranch("friendTrack0.fCalibContainer");
-	    if (br) sizeFriend+=br->GetZipBytes();
-	    if (sizeFriend*TMath::Abs(fFriendDownscaling)>sizeAll) {
-	      friendTrackStore0=0;
-	      friendTrackStore1=0;
-	    }
-	  }
+	if (IsFriendSizeExceeded(fCosmicPairsTree,fCosmicPairsFriendBranches,"friendTrack0")) {
+	  friendTrackStore0=0;
+	  friendTrackStore1=0;
 	}
       }
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
-      (*fTreeSRedirector)<<"CosmicPairs"<<
+      (*fCosmicPairsStream)<<
         "gid="<<gid<<                         // global id of track
         "fileName.="<<&fCurrentFileName<<     // file name
         "runNumber="<<runNumber<<             // run number	    
         "evtTimeStamp="<<timeStamp<<          // time stamp of event
         "evtNumberInFile="<<eventNumber<<     // event number	    
         "trigger="<<triggerMask<<             // trigger mask
-        "triggerClass="<<&triggerClass<<      // trigger class
+        "triggerClass="<<&fTriggerClass<<      // trigger class
         "Bz="<<magField<<                     // magnetic field
         //
         "multSPD="<<ntracksSPD<<              // event ultiplicity
@@ -703,17 +714,16 @@ void AliAnalysisTaskFilteredTree::Process(AliESDEvent *const esdEvent, AliMCEven
       // vertex
       // TPC-ITS tracks
       //
-      TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
       downscaleCounter++;
-      (*fTreeSRedirector)<<"highPt"<<
+      (*fHighPtStream)<<
         "gid="<<gid<<
         "fileName.="<<&fCurrentFileName<<            
         "runNumber="<<runNumber<<
         "evtTimeStamp="<<evtTimeStamp<<
         "evtNumberInFile="<<evtNumberInFile<<
-        "triggerClass="<<&triggerClass<<      //  trigger
+        "triggerClass="<<&fTriggerClass<<      //  trigger
         "Bz="<<bz<<                           //  magnetic field
         "vtxESD.="<<vtxESD<<
         "ntracksESD="<<ntracks<<              // number of tracks in the ESD
@@ -747,7 +757,6 @@ void AliAnalysisTaskFilteredTree::ProcessLaser(AliESDEvent *const esdEvent, AliM
     Int_t evtTimeStamp = esdEvent->GetTimeStamp();
     Int_t evtNumberInFile = esdEvent->GetEventNumberInFile();
     Float_t bz = esdEvent->GetMagneticField();
-    TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();    
     // Global event id calculation using orbitID, bunchCrossingID and periodID
     ULong64_t orbitID      = (ULong64_t)esdEvent->GetOrbitNumber();
     ULong64_t bunchCrossID = (ULong64_t)esdEvent->GetBunchCrossNumber();
@@ -764,13 +773,13 @@ void AliAnalysisTaskFilteredTree::ProcessLaser(AliESDEvent *const esdEvent, AliM
       Bool_t skipTrack=gRandom->Rndm()>1/(1+TMath::Abs(fFriendDownscaling));
       if (skipTrack) continue;
       if (esdFriend) {if (!esdFriend->TestSkipBit()) friendTrack = esdFriend->GetTrack(iTrack);} //this guy can be NULL      
-      (*fTreeSRedirector)<<"Laser"<<
+      (*fLaserStream)<<
         "gid="<<gid<<                          // global identifier of event
         "fileName.="<<&fCurrentFileName<<              //
         "runNumber="<<runNumber<<
         "evtTimeStamp="<<evtTimeStamp<<
         "evtNumberInFile="<<evtNumberInFile<<
-        "triggerClass="<<&triggerClass<<        //  trigger
+        "triggerClass="<<&fTriggerClass<<        //  trigger
         "Bz="<<bz<<                             //  magnetic field
         "multTPCtracks="<<countLaserTracks<<    //  multiplicity of tracks
 	"track.="<<track<<                      //  track parameters
@@ -924,7 +933,6 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
   ULong64_t bunchCrossID = (ULong64_t)esdEvent->GetBunchCrossNumber();
   ULong64_t periodID     = (ULong64_t)esdEvent->GetPeriodNumber();
   ULong64_t gid          = ((periodID << 36) | (orbitID << 12) | bunchCrossID); 
-  TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();
   Float_t bz = esdEvent->GetMagneticField();
   Int_t runNumber = esdEvent->GetRunNumber();
   Int_t evtTimeStamp = esdEvent->GetTimeStamp();
@@ -936,7 +944,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
     "runNumber="<<runNumber<<                             // runNumber
     "evtTimeStamp="<<evtTimeStamp<<           // time stamp of event (in seconds)
     "evtNumberInFile="<<evtNumberInFile<<     // event number
-    "triggerClass="<<&triggerClass<<          // trigger class as a string
+    "triggerClass="<<&fTriggerClass<<          // trigger class as a string
     "Bz="<<bz<<                               // solenoid magnetic field in the z direction (in kGaus)
     "mult="<<mult<<                           // multiplicity of tracks pointing to the primary vertex
     "ntracks="<<ntracks<<                     // number of the esd tracks (to take into account the pileup in the TPC)
@@ -1326,7 +1334,6 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
         //if(fUseESDfriends && isOKtrackInnerC2 && isOKouterITSc) dumpToTree = kTRUE;
         if(isOKtrackInnerC2 && isOKouterITSc) dumpToTree = kTRUE;
         if(mcEvent && isOKtrackInnerC3) dumpToTree = kTRUE;
-        TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();
         if (fReducePileUp){  
           //
           // 18.03 - Reduce pile-up chunks, done outside of the ESDTrackCuts for 2012/2013 data pile-up about 95 % of tracks
@@ -1366,17 +1373,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	  friendTrackStore = (gRandom->Rndm()<1./fFriendDownscaling)? friendTrack:0;
 	}
 	if (fFriendDownscaling<=0){
-	  if (((*fTreeSRedirector)<<"highPt").GetTree()){
-	    TTree * tree = ((*fTreeSRedirector)<<"highPt").GetTree();
-	    if (tree){
-	      Double_t sizeAll=tree->GetZipBytes();
-	      TBranch * br= tree->GetBranch("friendTrack.fPoints");
-	      Double_t sizeFriend=(br!=NULL)?br->GetZipBytes():0;
-	      br= tree->GetBranch("friendTrack.fCalibContainer");
-	      if (br) sizeFriend+=br->GetZipBytes();
-	      if (sizeFriend*TMath::Abs(fFriendDownscaling)>sizeAll) friendTrackStore=0;
-	    }
-	  }
+	  if (IsFriendSizeExceeded(fHighPtTree,fHighPtFriendBranches,"friendTrack")) friendTrackStore=0;
 	}
 
 
@@ -1422,14 +1419,14 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
 	}
         if(fTreeSRedirector && dumpToTree && fFillTree) {
 	  downscaleCounter++;
-          (*fTreeSRedirector)<<"highPt"<<
+          (*fHighPtStream)<<
 	    "downscaleCounter="<<downscaleCounter<<   
             "gid="<<gid<<
             "fileName.="<<&fCurrentFileName<<                // name of the chunk file (hopefully full)
             "runNumber="<<runNumber<<                // runNumber
             "evtTimeStamp="<<evtTimeStamp<<          // time stamp of event (in seconds)
             "evtNumberInFile="<<evtNumberInFile<<    // event number
-            "triggerClass="<<&triggerClass<<         // trigger class as a string
+            "triggerClass="<<&fTriggerClass<<         // trigger class as a string
             "Bz="<<bz<<                              // solenoid magnetic field in the z direction (in kGaus)
             "vtxESD.="<<vtxESD<<                    // vertexer ESD tracks (can be biased by TPC pileup tracks)
             "IRtot="<<ir1<<                         // interaction record (trigger) counters - coutner 1
@@ -1471,7 +1468,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
             if (!refEMCAL) refEMCAL = &refDummy;
             if (!refPHOS) refPHOS = &refDummy;
 	    downscaleCounter++;
-            (*fTreeSRedirector)<<"highPt"<<	
+            (*fHighPtStream)<<	
               "multMCTrueTracks="<<multMCTrueTracks<<   // mC track multiplicities
               "nrefITS="<<nrefITS<<              // number of track references in the ITS
               "nrefTPC="<<nrefTPC<<              // number of track references in the TPC
@@ -1509,8 +1506,8 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
               "isFromMaterialITS="<<isFromMaterialITS;
           }
           //finish writing the entry
-          AliInfo("writing tree highPt");
-          (*fTreeSRedirector)<<"highPt"<<"\n";
+          AliDebug(1,"writing tree highPt");
+          (*fHighPtStream)<<"\n";
         }
         AliSysInfo::AddStamp("filteringTask",iTrack,numberOfTracks,numberOfFriendTracks,(friendTrackStore)?0:1);
         delete tpcInnerC;
@@ -1652,7 +1649,6 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
   //printf("isEventOK %d, isEventTriggered %d \n",isEventOK, isEventTriggered);
   //printf("GetAnalysisMode() %d \n",GetAnalysisMode());
 
-  TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();
 
   // check event cuts
   if(isEventOK && isEventTriggered)
@@ -1763,9 +1759,9 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
       //
       if(fTreeSRedirector && fFillTree) {
 	downscaleCounter++;
-        (*fTreeSRedirector)<<"MCEffTree"<<
+        (*fMCEffStream)<<
           "fileName.="<<&fCurrentFileName<<
-          "triggerClass.="<<&triggerClass<<
+          "triggerClass.="<<&fTriggerClass<<
           "runNumber="<<runNumber<<
           "evtTimeStamp="<<evtTimeStamp<<
           "evtNumberInFile="<<evtNumberInFile<<     // 
@@ -1900,7 +1896,6 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
   ULong64_t bunchCrossID = (ULong64_t)esdEvent->GetBunchCrossNumber();
   ULong64_t periodID     = (ULong64_t)esdEvent->GetPeriodNumber();
   ULong64_t gid          = ((periodID << 36) | (orbitID << 12) | bunchCrossID); 
-  TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();
   Float_t bz = esdEvent->GetMagneticField();
   Int_t run = esdEvent->GetRunNumber();
   Int_t time = esdEvent->GetTimeStamp();
@@ -1913,7 +1908,7 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
     "run="<<run<<                             // runNumber
     "time="<<time<<                           // time stamp of event (in seconds)
     "evtNumberInFile="<<evtNumberInFile<<     // event number
-    "triggerClass="<<&triggerClass<<          // trigger class as a string
+    "triggerClass="<<&fTriggerClass<<          // trigger class as a string
     "Bz="<<bz<<                               // solenoid magnetic field in the z direction (in kGaus)
     "mult="<<mult<<                           // multiplicity of tracks pointing to the primary vertex
     "ntracks="<<ntracks<<                     // number of the esd tracks (to take into account the pileup in the TPC)
@@ -1970,19 +1965,9 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
 	}
       }
       if (fFriendDownscaling<=0){
-	if (((*fTreeSRedirector)<<"V0s").GetTree()){
-	  TTree * tree = ((*fTreeSRedirector)<<"V0s").GetTree();
-	  if (tree){
-	    Double_t sizeAll=tree->GetZipBytes();
-	    TBranch * br= tree->GetBranch("friendTrack0.fPoints");
-	    Double_t sizeFriend=(br!=NULL)?br->GetZipBytes():0;
-	    br= tree->GetBranch("friendTrack0.fCalibContainer");
-	    if (br) sizeFriend+=br->GetZipBytes();
-	    if (sizeFriend*TMath::Abs(fFriendDownscaling)>sizeAll) {
-	      friendTrackStore0=0;
-	      friendTrackStore1=0;
-	    }
-	  }
+	if (IsFriendSizeExceeded(fV0Tree,fV0FriendBranches,"friendTrack0")) {
+	  friendTrackStore0=0;
+	  friendTrackStore1=0;
 	}
       }
 
@@ -1992,7 +1977,6 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
       AliKFParticle kfparticle; //
       Int_t type=GetKFParticle(v0,esdEvent,kfparticle);
       if (type==0) continue;   
-      TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();
 
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
@@ -2027,10 +2011,10 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
       }
 
       downscaleCounter++;
-      (*fTreeSRedirector)<<"V0s"<<
+      (*fV0Stream)<<
         "gid="<<gid<<                         //  global id of event
         "isDownscaled="<<isDownscaled<<       //  
-        "triggerClass="<<&triggerClass<<      //  trigger
+        "triggerClass="<<&fTriggerClass<<      //  trigger
         "Bz="<<bz<<                           //
         "fileName.="<<&fCurrentFileName<<     //  full path - file name with ESD
         "runNumber="<<run<<                   //
@@ -2159,7 +2143,6 @@ void AliAnalysisTaskFilteredTree::ProcessdEdx(AliESDEvent *const esdEvent, AliMC
       if(!accCuts->AcceptTrack(track)) continue;
 
       if(!IsHighDeDxParticle(track)) continue;
-      TObjString triggerClass = esdEvent->GetFiredTriggerClasses().Data();
 
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
@@ -2178,13 +2161,13 @@ void AliAnalysisTaskFilteredTree::ProcessdEdx(AliESDEvent *const esdEvent, AliMC
       }
 	
       downscaleCounter++;
-      (*fTreeSRedirector)<<"dEdx"<<           // high dEdx tree
+      (*fdEdxStream)<<           // high dEdx tree
         "gid="<<gid<<                         // global id
         "fileName.="<<&fCurrentFileName<<     // file name
         "runNumber="<<runNumber<<
         "evtTimeStamp="<<evtTimeStamp<<
         "evtNumberInFile="<<evtNumberInFile<<
-        "triggerClass="<<&triggerClass<<      //  trigger
+        "triggerClass="<<&fTriggerClass<<      //  trigger
         "Bz="<<bz<<
         "vtxESD.="<<vtxESD<<                  // 
         "mult="<<mult<<
@@ -2320,6 +2303,22 @@ Int_t   AliAnalysisTaskFilteredTree::GetKFParticle(AliESDv0 *const v0, AliESDEve
   return ptype;  
 }
 
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskFilteredTree::IsFriendSizeExceeded(TTree *tree, TBranch **friendBranches, const char *friendName) const
+{
+  //
+  // Check if the friend track branches take more than 1/|fFriendDownscaling| of the tree size
+  // The friend branches exist after the first fill of the tree, they are looked up only until found
+  //
+  if (!tree) return kFALSE;
+  if (!friendBranches[0]) friendBranches[0]=tree->GetBranch(Form("%s.fPoints",friendName));
+  if (!friendBranches[1]) friendBranches[1]=tree->GetBranch(Form("%s.fCalibContainer",friendName));
+  Double_t sizeAll=tree->GetZipBytes();
+  Double_t sizeFriend=(friendBranches[0]!=NULL)?friendBranches[0]->GetZipBytes():0;
+  if (friendBranches[1]) sizeFriend+=friendBranches[1]->GetZipBytes();
+  return sizeFriend*TMath::Abs(fFriendDownscaling)>sizeAll;
+}
+
 //_____________________________________________________________________________
 Bool_t AliAnalysisTaskFilteredTree::IsV0Downscaled(AliESDv0 *const v0)
 {
@@ -2546,6 +2545,12 @@ void AliAnalysisTaskFilteredTree::FinishTaskOutput()
   }
   if (deleteTrees) delete fTreeSRedirector;
   fTreeSRedirector=NULL;
+  fHighPtStream=NULL;
+  fV0Stream=NULL;
+  fdEdxStream=NULL;
+  fLaserStream=NULL;
+  fMCEffStream=NULL;
+  fCosmicPairsStream=NULL;
 }
 
 //_____________________________________________________________________________
@@ -28,6 +28,8 @@ class TList;
 class TObjArray;
 class TTree;
 class TTreeSRedirector;
+class TTreeStream;
+class TBranch;
 class TParticle;
 class TH3D;
 
@@ -154,6 +156,16 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   TTree* fMCEffTree;        //! list send on output slot 0
   TTree* fCosmicPairsTree;  //! list send on output slot 0
 
+  TTreeStream* fHighPtStream;       //! stream of the highPt tree
+  TTreeStream* fV0Stream;           //! stream of the V0s tree
+  TTreeStream* fdEdxStream;         //! stream of the dEdx tree
+  TTreeStream* fLaserStream;        //! stream of the Laser tree
+  TTreeStream* fMCEffStream;        //! stream of the MCEffTree tree
+  TTreeStream* fCosmicPairsStream;  //! stream of the CosmicPairs tree
+  TBranch* fHighPtFriendBranches[2];       //! friend track fPoints and fCalibContainer branches of the highPt tree
+  TBranch* fV0FriendBranches[2];           //! same for the V0s tree
+  TBranch* fCosmicPairsFriendBranches[2];  //! same for the CosmicPairs tree
+
   TH3D* fPtResPhiPtTPC;    //! sigma(pt)/pt vs Phi vs Pt for prim. TPC tracks
   TH3D* fPtResPhiPtTPCc;   //! sigma(pt)/pt vs Phi vs Pt for prim. TPC contrained to vertex tracks
   TH3D* fPtResPhiPtTPCITS; //! sigma(pt)/pt vs Phi vs Pt for prim. TPC+ITS tracks
@@ -166,8 +178,11 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   TH3D* fPtResCentPtTPCc;   //! sigma(pt)/pt vs Cent vs Pt for prim. TPC contrained to vertex tracks
   TH3D* fPtResCentPtTPCITS; //! sigma(pt)/pt vs Cent vs Pt for prim. TPC+ITS tracks
   TObjString fCurrentFileName; // cached value of current file name
+  TObjString fTriggerClass;    //! fired trigger classes of the current event
   AliESDtrack* fDummyTrack; //! dummy track for tree init
 
+  Bool_t IsFriendSizeExceeded(TTree *tree, TBranch **friendBranches, const char *friendName) const;
+
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
   ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis